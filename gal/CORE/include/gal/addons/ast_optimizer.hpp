@@ -5,6 +5,8 @@
 
 #include <gal/foundation/ast.hpp>
 #include <gal/grammar.hpp>
+#include <unordered_map>
+#include <unordered_set>
 
 namespace gal::lang::addon
 {
@@ -24,6 +26,16 @@ namespace gal::lang::addon
 				((node = static_cast<Optimizers&>(*this)(std::move(node))), ...);
 				return node;
 			}
+
+			void bind_dispatcher(const foundation::dispatcher& dispatcher) override
+			{
+				(
+					[this, &dispatcher]
+					{
+						if constexpr (requires(Optimizers& optimizer) { optimizer.bind_dispatcher(dispatcher); }) { static_cast<Optimizers&>(*this).bind_dispatcher(dispatcher); }
+					}(),
+					...);
+			}
 		};
 
 		[[nodiscard]] inline bool node_empty(const ast::ast_node& node) noexcept
@@ -64,12 +76,48 @@ namespace gal::lang::addon
 					{
 						// return not child.template is_any<block_ast_node, for_ast_node, ranged_for_ast_node>() &&
 						//        node_has_var_decl(child);
-						const auto b1 = not child.template is_any<ast::block_ast_node, ast::ranged_for_ast_node>();
+						const auto b1 = not child.template is_any<ast::block_ast_node, ast::ranged_for_ast_node, ast::counted_for_ast_node>();
 						const auto b2 = node_has_var_decl(child);
 						return b1 & b2;
 					});
 		}
 
+		[[nodiscard]] inline bool node_references(const ast::ast_node& node, const ast::ast_node::identifier_type name) noexcept
+		{
+			if (node.is<ast::id_ast_node>() && node.identifier() == name) { return true; }
+			return std::ranges::any_of(node.view(), [name](const auto& child) { return node_references(child, name); });
+		}
+
+		// the operation only reads its operands
+		[[nodiscard]] inline bool is_reading_operation(const foundation::algebraic_operations operation) noexcept
+		{
+			using enum foundation::algebraic_operations;
+			switch (operation)
+			{
+				case equal:
+				case not_equal:
+				case less_than:
+				case less_equal:
+				case greater_than:
+				case greater_equal:
+				case plus:
+				case minus:
+				case multiply:
+				case divide:
+				case remainder:
+				case bitwise_shift_left:
+				case bitwise_shift_right:
+				case bitwise_and:
+				case bitwise_or:
+				case bitwise_xor:
+				case unary_not:
+				case unary_plus:
+				case unary_minus:
+				case unary_bitwise_complement: { return true; }
+				default: { return false; }
+			}
+		}
+
 		struct return_optimizer
 		{
 			ast::ast_node_ptr operator()(ast::ast_node_ptr p) const
@@ -129,10 +177,15 @@ namespace gal::lang::addon
 				{
 					auto children = p->exchange_children();
 
-					const auto view = std::ranges::remove_if(
-							children,
-							[](const auto& child) { return child->template is_any<ast::noop_ast_node, ast::id_ast_node, ast::constant_ast_node>(); });
-					children.erase(view.begin(), view.end());
+					if (not children.empty())
+					{
+						// the last statement is the value of the block
+						const auto view = std::ranges::remove_if(
+								children.begin(),
+								std::ranges::prev(children.end()),
+								[](const auto& child) { return child->template is_any<ast::noop_ast_node, ast::id_ast_node, ast::constant_ast_node>(); });
+						children.erase(view.begin(), view.end());
+					}
 
 					[[maybe_unused]] const auto result = p->exchange_children(std::move(children));
 					gal_assert(result.empty());
@@ -160,7 +213,7 @@ namespace gal::lang::addon
 					gal_assert(result.empty());
 				}
 				else if (
-					p->is_any<ast::ranged_for_ast_node, ast::while_ast_node>())
+					p->is_any<ast::ranged_for_ast_node, ast::counted_for_ast_node, ast::while_ast_node>())
 				{
 					if (const auto size = node_size(*p); size > 0)
 					{
@@ -323,6 +376,17 @@ namespace gal::lang::addon
 						}
 					}
 				}
+				else if (
+					p->is<ast::fold_right_binary_operator_ast_node>() &&
+					p->size() == 1 &&
+					p->get_child(grammar::fold_right_binary_operator_ast_node::lhs_index).is<ast::constant_ast_node>()
+				)
+				{
+					// the left-hand-side becomes a constant after the constant propagation
+					const auto& lhs = dynamic_cast<const ast::constant_ast_node&>(p->get_child(grammar::fold_right_binary_operator_ast_node::lhs_index)).value;
+					if (const auto& rhs = dynamic_cast<const ast::fold_right_binary_operator_ast_node&>(*p).rhs();
+						lhs.type_info().is_arithmetic()) { return std::move(*p).remake_node<ast::constant_ast_node>(types::number_type::binary_invoke(foundation::algebraic_operation(p->identifier()), lhs, rhs)); }
+				}
 				// conversion of numeric literals
 				else if (
 					p->is<ast::fun_call_ast_node>() &&
@@ -349,18 +413,1128 @@ namespace gal::lang::addon
 			}
 		};
 
+		struct counted_for_optimizer
+		{
+			ast::ast_node_ptr operator()(ast::ast_node_ptr p) const
+			{
+				if (
+					p->is<ast::ranged_for_ast_node>() &&
+					p->size() == 3 &&
+					p->get_child(grammar::ranged_for_ast_node::loop_range_name_index).is<ast::fun_call_ast_node>()
+				)
+				{
+					// the result is still checked at runtime, 'range' may be overloaded
+					if (const auto& function = p->get_child(grammar::ranged_for_ast_node::loop_range_name_index).get_child(grammar::fun_call_ast_node::function_index);
+						function.is<ast::id_ast_node>() && function.identifier() == foundation::range_type_name::value) { return std::move(*p).remake_node<ast::counted_for_ast_node>(); }
+				}
+
+				return p;
+			}
+		};
+
+		struct loop_invariant_optimizer
+		{
+		private:
+			using identifier_type = ast::ast_node::identifier_type;
+			using identifiers_type = ast::loop_invariant_scope::identifiers_type;
+			using calls_type = std::vector<ast::loop_invariant_scope::call_type>;
+			using values_size_type = ast::loop_invariant_scope::values_type::size_type;
+
+			struct loop_info
+			{
+				calls_type calls;
+				identifiers_type modified;
+				std::vector<ast::loop_invariant_scope::alias_type> aliases;
+				// the calls made by each node
+				std::unordered_map<const ast::ast_node*, std::vector<calls_type::size_type>> call_nodes;
+				// the hidden variables of the nested loops are named before it
+				std::size_t name_index{0};
+			};
+
+			static void add_name(identifiers_type& names, const identifier_type name)
+			{
+				if (std::ranges::find(names, name) == names.end()) { names.push_back(name); }
+			}
+
+			[[nodiscard]] static std::unique_ptr<ast::loop_invariant_scope>* invariants_of(ast::ast_node& node) noexcept
+			{
+				if (node.is<ast::while_ast_node>()) { return &dynamic_cast<ast::while_ast_node&>(node).invariants; }
+				if (node.is<ast::ranged_for_ast_node>()) { return &dynamic_cast<ast::ranged_for_ast_node&>(node).invariants; }
+				if (node.is<ast::counted_for_ast_node>()) { return &dynamic_cast<ast::counted_for_ast_node&>(node).invariants; }
+				return nullptr;
+			}
+
+			// the variables referred in the node, the names of the functions and the members are not variables
+			static void collect_roots(const ast::ast_node& node, identifiers_type& roots)
+			{
+				if (node.is<ast::id_ast_node>())
+				{
+					add_name(roots, node.identifier());
+					return;
+				}
+
+				for (decltype(node.size()) i = 0; i < node.size(); ++i)
+				{
+					const auto& child = node.get_child(i);
+
+					if (node.is<ast::dot_access_ast_node>() && i == grammar::dot_access_ast_node::function_index)
+					{
+						// the member name, but the arguments of 'a.f(arguments)' are still visited
+						if (not child.is<ast::id_ast_node>()) { std::ranges::for_each(child.sub_view(1), [&roots](const auto& c) { collect_roots(c, roots); }); }
+						continue;
+					}
+					if (
+						node.is_any<ast::fun_call_ast_node, ast::unused_return_fun_call_ast_node, ast::tail_call_ast_node, ast::inline_call_ast_node>() &&
+						i == grammar::fun_call_ast_node::function_index &&
+						child.is<ast::id_ast_node>()) { continue; }
+
+					collect_roots(child, roots);
+				}
+			}
+
+			[[nodiscard]] static identifiers_type roots_of(const ast::ast_node& node)
+			{
+				identifiers_type roots{};
+				collect_roots(node, roots);
+				return roots;
+			}
+
+			// the variable passed as the argument, or empty if the argument is not a variable
+			[[nodiscard]] static identifier_type argument_of(const ast::ast_node& node) noexcept { return node.is<ast::id_ast_node>() ? node.identifier() : identifier_type{}; }
+
+			static void add_call(
+					loop_info& loop,
+					const ast::ast_node& node,
+					const identifier_type name,
+					identifiers_type&& arguments,
+					identifiers_type&& operands,
+					const bool by_name = false,
+					const bool any_arity = false)
+			{
+				loop.call_nodes[&node].push_back(loop.calls.size());
+				loop.calls.push_back({.name = name, .arguments = std::move(arguments), .operands = std::move(operands), .by_name = by_name, .any_arity = any_arity, .cached = false});
+			}
+
+			[[nodiscard]] static bool visit_children(loop_info& loop, ast::ast_node& node) { return std::ranges::all_of(node.view(), [&loop](auto& child) { return visit(loop, child); }); }
+
+			[[nodiscard]] static bool visit_for(loop_info& loop, ast::ast_node& node, const bool nested)
+			{
+				auto& range = node.get_child(grammar::ranged_for_ast_node::loop_range_name_index);
+				const auto loop_variable = node.get_child(grammar::ranged_for_ast_node::loop_variable_name_index).get_child(0).identifier();
+
+				add_name(loop.modified, loop_variable);
+				// the loop variable refers to the elements of the range
+				loop.aliases.push_back({.name = loop_variable, .targets = roots_of(range)});
+
+				add_call(loop, node, foundation::container_view_interface_name::value, {argument_of(range)}, roots_of(range));
+				add_call(loop, node, foundation::container_view_empty_interface_name::value, {identifier_type{}}, {});
+				add_call(loop, node, foundation::container_view_star_interface_name::value, {identifier_type{}}, {});
+				add_call(loop, node, foundation::container_view_advance_interface_name::value, {identifier_type{}}, {});
+
+				// the range of the outermost loop is evaluated before entering the loop
+				return (not nested || visit(loop, range)) && visit(loop, node.get_child(grammar::ranged_for_ast_node::body_index));
+			}
+
+			/**
+			 * @brief Collect the calls and the modified variables of the node, return false if the node is not supported.
+			 */
+			[[nodiscard]] static bool visit(loop_info& loop, ast::ast_node& node)
+			{
+				if (node.is_any<ast::id_ast_node, ast::constant_ast_node, ast::noop_ast_node, ast::break_ast_node, ast::continue_ast_node>()) { return true; }
+
+				if (
+					node.is_any<
+						ast::block_ast_node,
+						ast::no_scope_block_ast_node,
+						ast::if_ast_node,
+						ast::logical_and_ast_node,
+						ast::logical_or_ast_node,
+						ast::return_ast_node,
+						ast::arg_list_ast_node,
+						ast::map_pair_ast_node,
+						ast::loop_invariant_ast_node>()) { return visit_children(loop, node); }
+
+				if (node.is_any<ast::while_ast_node, ast::ranged_for_ast_node, ast::counted_for_ast_node>())
+				{
+					if (const auto& invariants = *invariants_of(node)) { loop.name_index = std::max(loop.name_index, invariants->name_index() + 1); }
+
+					if (node.is<ast::while_ast_node>()) { return visit_children(loop, node); }
+					return visit_for(loop, node, true);
+				}
+
+				if (node.is_any<ast::var_decl_ast_node, ast::reference_ast_node, ast::global_decl_ast_node>())
+				{
+					collect_roots(node, loop.modified);
+					return true;
+				}
+
+				if (node.is<ast::assign_decl_ast_node>())
+				{
+					add_name(loop.modified, node.get_child(grammar::assign_decl_ast_node::lhs_index).identifier());
+					add_call(loop, node, foundation::object_clone_interface_name::value, {identifier_type{}}, {});
+					return visit(loop, node.get_child(grammar::assign_decl_ast_node::rhs_index));
+				}
+
+				if (node.is<ast::equation_ast_node>())
+				{
+					auto& lhs = node.get_child(grammar::equation_ast_node::lhs_index);
+					auto& rhs = node.get_child(grammar::equation_ast_node::rhs_index);
+
+					auto operands = roots_of(lhs);
+					std::ranges::for_each(operands, [&loop](const auto name) { add_name(loop.modified, name); });
+
+					// 'ref name = object', the variable refers to the object (others are copied)
+					if (
+						lhs.is<ast::reference_ast_node>() ||
+						(lhs.is<ast::global_decl_ast_node>() && lhs.get_child(grammar::global_decl_ast_node::index).is<ast::reference_ast_node>())) { loop.aliases.push_back({.name = operands.front(), .targets = roots_of(rhs)}); }
+
+					add_call(loop, node, node.identifier(), {argument_of(lhs), argument_of(rhs)}, std::move(operands));
+					add_call(loop, node, foundation::object_clone_interface_name::value, {identifier_type{}}, {});
+					return visit(loop, lhs) && visit(loop, rhs);
+				}
+
+				if (node.is_any<ast::binary_operator_ast_node, ast::fold_right_binary_operator_ast_node>())
+				{
+					identifiers_type arguments{};
+					std::ranges::for_each(node.view(), [&arguments](const auto& child) { arguments.push_back(argument_of(child)); });
+					// the folded right-hand-side
+					if (node.is<ast::fold_right_binary_operator_ast_node>()) { arguments.emplace_back(); }
+
+					add_call(loop, node, node.identifier(), std::move(arguments), is_reading_operation(foundation::algebraic_operation(node.identifier())) ? identifiers_type{} : roots_of(node));
+					return visit_children(loop, node);
+				}
+
+				if (node.is<ast::unary_operator_ast_node>())
+				{
+					auto operands = roots_of(node);
+					if (is_reading_operation(foundation::algebraic_operation(node.identifier(), true))) { operands.clear(); }
+					// ++i
+					else { std::ranges::for_each(operands, [&loop](const auto name) { add_name(loop.modified, name); }); }
+
+					add_call(loop, node, node.identifier(), {argument_of(node.get_child(grammar::unary_operator_ast_node::index))}, std::move(operands));
+					return visit_children(loop, node);
+				}
+
+				if (node.is_any<ast::fun_call_ast_node, ast::unused_return_fun_call_ast_node, ast::inline_call_ast_node>())
+				{
+					const auto& function = node.get_child(grammar::fun_call_ast_node::function_index);
+					if (not function.is<ast::id_ast_node>()) { return false; }
+
+					identifiers_type arguments{};
+					identifiers_type operands{};
+					if (node.size() > grammar::fun_call_ast_node::arg_list_index)
+					{
+						const auto& arg_list = node.get_child(grammar::fun_call_ast_node::arg_list_index);
+						std::ranges::for_each(arg_list.view(), [&arguments](const auto& arg) { arguments.push_back(argument_of(arg)); });
+						operands = roots_of(arg_list);
+					}
+
+					add_call(loop, node, function.identifier(), std::move(arguments), std::move(operands), true);
+					return std::ranges::all_of(node.sub_view(1), [&loop](auto& child) { return visit(loop, child); });
+				}
+
+				if (node.is<ast::array_access_ast_node>())
+				{
+					add_call(
+							loop,
+							node,
+							foundation::container_subscript_interface_name::value,
+							{argument_of(node.get_child(grammar::array_access_ast_node::operation_target_index)), argument_of(node.get_child(grammar::array_access_ast_node::operation_parameter_index))},
+							roots_of(node));
+					return visit_children(loop, node);
+				}
+
+				if (node.is<ast::dot_access_ast_node>())
+				{
+					auto& target = node.get_child(grammar::dot_access_ast_node::target_index);
+					auto& function = node.get_child(grammar::dot_access_ast_node::function_index);
+					const auto operands = roots_of(node);
+
+					identifiers_type arguments{argument_of(target)};
+					if (function.is<ast::fun_call_ast_node>() && function.size() > grammar::dot_access_ast_node::function_parameter_index)
+					{
+						std::ranges::for_each(
+								function.get_child(grammar::dot_access_ast_node::function_parameter_index).view(),
+								[&arguments](const auto& arg) { arguments.push_back(argument_of(arg)); });
+					}
+
+					const auto name = function.is_any<ast::fun_call_ast_node, ast::array_access_ast_node>() ? function.get_child(grammar::dot_access_ast_node::function_secondary_index).identifier() : function.identifier();
+					add_call(loop, node, name, std::move(arguments), identifiers_type{operands});
+					add_call(loop, node, foundation::dynamic_object::missing_method_name, {argument_of(target)}, identifiers_type{operands}, false, true);
+					if (function.is<ast::array_access_ast_node>()) { add_call(loop, node, foundation::container_subscript_interface_name::value, {identifier_type{}, argument_of(function.get_child(grammar::array_access_ast_node::operation_parameter_index))}, identifiers_type{operands}); }
+
+					return visit(loop, target) && (function.is<ast::id_ast_node>() || std::ranges::all_of(function.sub_view(1), [&loop](auto& child) { return visit(loop, child); }));
+				}
+
+				if (node.is<ast::string_interpolation_ast_node>())
+				{
+					std::ranges::for_each(node.view(), [&loop, &node](const auto& part) { add_call(loop, node, foundation::operator_to_string_name::value, {argument_of(part)}, roots_of(part)); });
+					return visit_children(loop, node);
+				}
+
+				if (node.is_any<ast::inline_list_ast_node, ast::inline_map_ast_node>())
+				{
+					add_call(loop, node, foundation::object_clone_interface_name::value, {identifier_type{}}, {});
+					return visit_children(loop, node);
+				}
+
+				// functions, classes, exceptions...
+				return false;
+			}
+
+			// the child is only read by the parent, its value is neither modified nor kept
+			[[nodiscard]] static bool is_reading(const ast::ast_node& parent, const ast::ast_node::children_type::size_type index) noexcept
+			{
+				if (parent.is_any<ast::binary_operator_ast_node, ast::fold_right_binary_operator_ast_node>()) { return is_reading_operation(foundation::algebraic_operation(parent.identifier())); }
+				if (parent.is<ast::unary_operator_ast_node>()) { return is_reading_operation(foundation::algebraic_operation(parent.identifier(), true)); }
+				if (parent.is_any<ast::logical_and_ast_node, ast::logical_or_ast_node>()) { return true; }
+				if (parent.is<ast::if_ast_node>()) { return index == grammar::if_ast_node::condition_index; }
+				if (parent.is<ast::while_ast_node>()) { return index == grammar::while_ast_node::condition_index; }
+				return false;
+			}
+
+			// the value of the node only depends on the variables not declared or assigned in the loop (if the calls are pure)
+			[[nodiscard]] static bool is_invariant(const loop_info& loop, const ast::ast_node& node)
+			{
+				const auto all_invariant = [&loop](const auto& children) { return std::ranges::all_of(children, [&loop](const auto& child) { return is_invariant(loop, child); }); };
+
+				if (node.is<ast::constant_ast_node>()) { return true; }
+				if (node.is<ast::id_ast_node>()) { return std::ranges::find(loop.modified, node.identifier()) == loop.modified.end(); }
+				if (node.is_any<ast::arg_list_ast_node, ast::array_access_ast_node>()) { return all_invariant(node.view()); }
+				if (node.is_any<ast::binary_operator_ast_node, ast::fold_right_binary_operator_ast_node>()) { return is_reading_operation(foundation::algebraic_operation(node.identifier())) && all_invariant(node.view()); }
+				if (node.is<ast::unary_operator_ast_node>()) { return is_reading_operation(foundation::algebraic_operation(node.identifier(), true)) && all_invariant(node.view()); }
+				if (node.is<ast::fun_call_ast_node>()) { return node.get_child(grammar::fun_call_ast_node::function_index).is<ast::id_ast_node>() && all_invariant(node.sub_view(1)); }
+				if (node.is<ast::dot_access_ast_node>())
+				{
+					const auto& function = node.get_child(grammar::dot_access_ast_node::function_index);
+					return is_invariant(loop, node.get_child(grammar::dot_access_ast_node::target_index)) &&
+					       (function.is<ast::id_ast_node>() || (function.is_any<ast::fun_call_ast_node, ast::array_access_ast_node>() && all_invariant(function.sub_view(1))));
+				}
+
+				return false;
+			}
+
+			static void mark_cached(loop_info& loop, const ast::ast_node& node)
+			{
+				if (const auto it = loop.call_nodes.find(&node);
+					it != loop.call_nodes.end()) { std::ranges::for_each(it->second, [&loop](const auto index) { loop.calls[index].cached = true; }); }
+
+				std::ranges::for_each(node.view(), [&loop](const auto& child) { mark_cached(loop, child); });
+			}
+
+			/**
+			 * @brief Replace the invariant expressions (the largest ones) in the node, return the number of them.
+			 */
+			static values_size_type hoist(loop_info& loop, ast::ast_node& node, identifiers_type& reads, const foundation::string_view_type name, values_size_type count)
+			{
+				// hoisted out of the nested loop already
+				if (node.is<ast::loop_invariant_ast_node>()) { return count; }
+
+				for (decltype(node.size()) i = 0; i < node.size(); ++i)
+				{
+					if (auto& child = node.get_child_ptr(i);
+						is_reading(node, i) &&
+						not child->is_any<ast::id_ast_node, ast::constant_ast_node>() &&
+						is_invariant(loop, *child))
+					{
+						mark_cached(loop, *child);
+						collect_roots(*child, reads);
+						child = ast::make_node<ast::loop_invariant_ast_node>(std::move(child), name, count);
+						++count;
+					}
+					else { count = hoist(loop, *child, reads, name, count); }
+				}
+
+				return count;
+			}
+
+		public:
+			ast::ast_node_ptr operator()(ast::ast_node_ptr p) const
+			{
+				if (not p->is_any<ast::while_ast_node, ast::ranged_for_ast_node, ast::counted_for_ast_node>()) { return p; }
+
+				loop_info loop{};
+				if (const auto is_while = p->is<ast::while_ast_node>();
+					not (is_while ? visit_children(loop, *p) : visit_for(loop, *p, false))) { return p; }
+
+				// too many nested loops
+				if (loop.name_index >= ast::loop_invariant_scope::names.size()) { return p; }
+
+				const auto name = ast::loop_invariant_scope::names[loop.name_index];
+				identifiers_type reads{};
+				// the range of the for loop is evaluated only once
+				const auto size = p->is<ast::while_ast_node>() ? hoist(loop, *p, reads, name, 0) : hoist(loop, p->get_child(grammar::ranged_for_ast_node::body_index), reads, name, 0);
+				if (size == 0) { return p; }
+
+				*invariants_of(*p) = std::make_unique<ast::loop_invariant_scope>(
+						loop.name_index,
+						size,
+						std::move(loop.calls),
+						std::move(loop.modified),
+						std::move(loop.aliases),
+						std::move(reads),
+						roots_of(*p));
+
+				return p;
+			}
+		};
+
+		struct constant_match_optimizer
+		{
+			ast::ast_node_ptr operator()(ast::ast_node_ptr p) const
+			{
+				if (p->is<ast::match_ast_node>() && p->size() >= 2)
+				{
+					// all case values are integral constants (with the same signedness) or all of them are string constants
+					bool has_integral = false;
+					bool has_string = false;
+					std::optional<bool> integral_signed{};
+
+					for (const auto& child: p->sub_view(1))
+					{
+						if (child.is<ast::match_default_ast_node>()) { continue; }
+						if (not child.is<ast::match_case_ast_node>()) { return p; }
+
+						const auto& value_node = child.get_child(grammar::match_case_ast_node::match_value_index);
+						if (not value_node.is<ast::constant_ast_node>()) { return p; }
+
+						if (const auto& value = dynamic_cast<const ast::constant_ast_node&>(value_node).value;
+							value.type_info().bare_equal(types::string_type::class_type())) { has_string = true; }
+						else if (const auto key = types::number_type::integral_key(value);
+							key.has_value() && integral_signed.value_or(key->second) == key->second)
+						{
+							has_integral = true;
+							integral_signed = key->second;
+						}
+						else { return p; }
+					}
+
+					if (has_integral != has_string) { return std::move(*p).remake_node<ast::constant_match_ast_node>(); }
+				}
+
+				return p;
+			}
+		};
+
+		struct constant_propagation_optimizer
+		{
+		private:
+			using identifier_type = ast::ast_node::identifier_type;
+			using replaced_nodes_type = std::unordered_set<const ast::ast_node*>;
+
+			const foundation::dispatcher* dispatcher_{nullptr};
+			// the names declared by the script being parsed, an immutable global with the same name may be shadowed by them
+			std::unordered_set<identifier_type> bound_names_;
+
+			// the child only reads the value, it cannot modify or rebind the variable
+			[[nodiscard]] static bool is_reading(const ast::ast_node& parent, const ast::ast_node::children_type::size_type index) noexcept
+			{
+				if (parent.is_any<ast::binary_operator_ast_node, ast::fold_right_binary_operator_ast_node>()) { return is_reading_operation(foundation::algebraic_operation(parent.identifier())); }
+				if (parent.is<ast::unary_operator_ast_node>()) { return is_reading_operation(foundation::algebraic_operation(parent.identifier(), true)); }
+				if (parent.is_any<ast::logical_and_ast_node, ast::logical_or_ast_node>()) { return true; }
+				if (parent.is<ast::if_ast_node>()) { return index == grammar::if_ast_node::condition_index; }
+				if (parent.is<ast::while_ast_node>()) { return index == grammar::while_ast_node::condition_index; }
+				// the arithmetic / boolean / string values are copied
+				if (parent.is<ast::assign_decl_ast_node>()) { return index == grammar::assign_decl_ast_node::rhs_index; }
+				return false;
+			}
+
+			// the child declares a name instead of referring to a variable
+			[[nodiscard]] static bool is_binding(const ast::ast_node& parent, const ast::ast_node::children_type::size_type index) noexcept
+			{
+				if (parent.is_any<ast::var_decl_ast_node, ast::reference_ast_node, ast::global_decl_ast_node, ast::arg_ast_node, ast::member_decl_ast_node, ast::class_decl_ast_node>()) { return true; }
+				if (parent.is<ast::assign_decl_ast_node>()) { return index == grammar::assign_decl_ast_node::lhs_index; }
+				if (parent.is_any<ast::ranged_for_ast_node, ast::counted_for_ast_node>()) { return index == grammar::ranged_for_ast_node::loop_variable_name_index; }
+				if (parent.is_any<ast::def_ast_node, ast::method_ast_node>()) { return index == grammar::def_ast_node::function_name_index; }
+				return false;
+			}
+
+			// the child names a function (or a member), it is not looked up as a variable
+			[[nodiscard]] static bool is_function_name(const ast::ast_node& parent, const ast::ast_node::children_type::size_type index) noexcept
+			{
+				if (parent.is<ast::dot_access_ast_node>()) { return index == grammar::dot_access_ast_node::function_index; }
+				if (parent.is_any<ast::fun_call_ast_node, ast::unused_return_fun_call_ast_node, ast::tail_call_ast_node, ast::inline_call_ast_node>()) { return index == grammar::fun_call_ast_node::function_index; }
+				return false;
+			}
+
+			template<typename Function>
+			static void for_each_body(ast::ast_node& node, Function function)
+			{
+				if (node.is<ast::def_ast_node>())
+				{
+					auto& def = dynamic_cast<ast::def_ast_node&>(node);
+					if (def.guard_node) { function(*def.guard_node); }
+					if (def.body_node) { function(*def.body_node); }
+				}
+				else if (node.is<ast::method_ast_node>())
+				{
+					auto& method = dynamic_cast<ast::method_ast_node&>(node);
+					if (method.guard_node) { function(*method.guard_node); }
+					if (method.body_node) { function(*method.body_node); }
+				}
+				else if (node.is<ast::lambda_ast_node>()) { if (auto& body = dynamic_cast<ast::lambda_ast_node&>(node).body_node()) { function(*body); } }
+			}
+
+			[[nodiscard]] static bool is_propagable(const foundation::boxed_value& value) noexcept
+			{
+				const auto& type = value.type_info();
+				return type.is_arithmetic() || type.bare_equal(typeid(bool)) || type.bare_equal(types::string_type::class_type());
+			}
+
+			/**
+			 * @brief Collect the uses of a local variable in its scope, return false if the variable may be modified or rebound there.
+			 */
+			[[nodiscard]] static bool find_local_uses(ast::ast_node& node, const identifier_type name, std::vector<ast::ast_node_ptr*>& uses)
+			{
+				// a new stack, the variable is not visible
+				if (node.is_any<ast::def_ast_node, ast::method_ast_node, ast::class_decl_ast_node>()) { return true; }
+				// the lambda may capture (and modify) it
+				if (node.is<ast::lambda_ast_node>()) { return not node_references(node, name); }
+
+				for (decltype(node.size()) i = 0; i < node.size(); ++i)
+				{
+					auto& child_ptr = node.get_child_ptr(i);
+					if (child_ptr->is<ast::compiled_ast_node>()) { return false; }
+
+					if (is_function_name(node, i) && node.is<ast::dot_access_ast_node>())
+					{
+						// the member name, but the arguments of 'a.f(arguments)' are still visited
+						if (child_ptr->is<ast::id_ast_node>()) { continue; }
+						for (decltype(child_ptr->size()) j = 1; j < child_ptr->size(); ++j) { if (not find_local_uses(*child_ptr->get_child_ptr(j), name, uses)) { return false; } }
+						continue;
+					}
+
+					if (child_ptr->is<ast::id_ast_node>())
+					{
+						if (child_ptr->identifier() != name) { continue; }
+						if (not is_reading(node, i)) { return false; }
+						uses.push_back(&child_ptr);
+					}
+					else if (not find_local_uses(*child_ptr, name, uses)) { return false; }
+				}
+
+				return true;
+			}
+
+			void collect_bound_names(ast::ast_node& node)
+			{
+				for (decltype(node.size()) i = 0; i < node.size(); ++i)
+				{
+					if (auto& child = *node.get_child_ptr(i);
+						child.is<ast::id_ast_node>()) { if (is_binding(node, i)) { bound_names_.insert(child.identifier()); } }
+					else { collect_bound_names(child); }
+				}
+
+				for_each_body(node, [this](auto& body) { collect_bound_names(body); });
+			}
+
+			void substitute_globals(ast::ast_node& node, replaced_nodes_type& replaced, std::unordered_map<identifier_type, std::optional<foundation::boxed_value>>& globals) const
+			{
+				for (decltype(node.size()) i = 0; i < node.size(); ++i)
+				{
+					auto& child_ptr = node.get_child_ptr(i);
+
+					if (is_function_name(node, i) && node.is<ast::dot_access_ast_node>())
+					{
+						if (child_ptr->is<ast::id_ast_node>()) { continue; }
+						for (decltype(child_ptr->size()) j = 1; j < child_ptr->size(); ++j) { substitute_globals(*child_ptr->get_child_ptr(j), replaced, globals); }
+						continue;
+					}
+
+					if (child_ptr->is<ast::id_ast_node>())
+					{
+						const auto name = child_ptr->identifier();
+						if (is_binding(node, i) || is_function_name(node, i) || bound_names_.contains(name)) { continue; }
+
+						auto [it, inserted] = globals.try_emplace(name, std::nullopt);
+						if (inserted) { it->second = dispatcher_->get_immutable_global(name); }
+
+						if (it->second.has_value())
+						{
+							child_ptr = std::move(*child_ptr).remake_node<ast::constant_ast_node>(foundation::boxed_value{*it->second});
+							replaced.insert(child_ptr.get());
+						}
+					}
+					else { substitute_globals(*child_ptr, replaced, globals); }
+				}
+
+				for_each_body(node, [this, &replaced, &globals](auto& body) { substitute_globals(body, replaced, globals); });
+			}
+
+			[[nodiscard]] static ast::ast_node_ptr fold(ast::ast_node_ptr p)
+			{
+				p = constant_fold_optimizer{}(std::move(p));
+				p = binary_fold_optimizer{}(std::move(p));
+				p = constant_if_optimizer{}(std::move(p));
+				return dead_code_optimizer{}(std::move(p));
+			}
+
+			/**
+			 * @brief Fold the nodes whose children are replaced again, return true if the node is replaced.
+			 */
+			static bool refold(ast::ast_node_ptr& p, const replaced_nodes_type& replaced, const bool into_function_body)
+			{
+				if (replaced.contains(p.get())) { return true; }
+
+				bool changed = false;
+				for (decltype(p->size()) i = 0; i < p->size(); ++i) { changed |= refold(p->get_child_ptr(i), replaced, into_function_body); }
+
+				// the root of the function body is shared with the function (and the inlined calls), keep it
+				if (into_function_body) { for_each_body(*p, [&replaced](auto& body) { for (decltype(body.size()) i = 0; i < body.size(); ++i) { (void)refold(body.get_child_ptr(i), replaced, true); } }); }
+
+				if (changed) { p = fold(std::move(p)); }
+				return changed;
+			}
+
+			// var name = constant; => the reads of 'name' after the declaration are replaced by the constant
+			static void propagate_locals(ast::ast_node& scope)
+			{
+				for (decltype(scope.size()) i = 0; i < scope.size(); ++i)
+				{
+					auto& decl = *scope.get_child_ptr(i);
+					if (
+						not decl.is<ast::assign_decl_ast_node>() ||
+						not decl.get_child(grammar::assign_decl_ast_node::lhs_index).is<ast::id_ast_node>() ||
+						not decl.get_child(grammar::assign_decl_ast_node::rhs_index).is<ast::constant_ast_node>()) { continue; }
+
+					const auto& value = dynamic_cast<const ast::constant_ast_node&>(decl.get_child(grammar::assign_decl_ast_node::rhs_index)).value;
+					if (not is_propagable(value)) { continue; }
+
+					const auto name = decl.get_child(grammar::assign_decl_ast_node::lhs_index).identifier();
+
+					std::vector<ast::ast_node_ptr*> uses{};
+					if (not std::ranges::all_of(scope.sub_view_ptr(static_cast<ast::ast_node::children_type::difference_type>(i) + 1), [name, &uses](auto& statement) { return find_local_uses(*statement, name, uses); })) { continue; }
+					if (uses.empty()) { continue; }
+
+					replaced_nodes_type replaced{};
+					for (auto* use: uses)
+					{
+						*use = std::move(**use).remake_node<ast::constant_ast_node>(foundation::boxed_value{value});
+						replaced.insert(use->get());
+					}
+
+					for (auto j = i + 1; j < scope.size(); ++j) { (void)refold(scope.get_child_ptr(j), replaced, false); }
+				}
+			}
+
+			[[nodiscard]] static foundation::boxed_value make_constant(const foundation::boxed_value& value)
+			{
+				if (value.type_info().bare_equal(typeid(bool))) { return const_var(boxed_cast<bool>(value)); }
+				if (value.type_info().bare_equal(types::string_type::class_type())) { return const_var(boxed_cast<const types::string_type&>(value)); }
+				return types::number_type::clone(value);
+			}
+
+			/**
+			 * @brief Call the function at parse time, only if every overload that may be called is pure and its result is a new value.
+			 *
+			 * @note The overloads are the ones visible at parse time, the functions added after the script is parsed are not considered.
+			 */
+			[[nodiscard]] std::optional<foundation::boxed_value> invoke_pure(const identifier_type name, const foundation::parameters_view_type params) const
+			{
+				// the name may refer to a variable (that holds a function) at runtime
+				if (bound_names_.contains(name) || dispatcher_->find_object(name).has_value()) { return std::nullopt; }
+
+				foundation::dispatcher::function_cache_location_type location{};
+				const auto& functions = dispatcher_->get_function(name, location);
+				if (not functions) { return std::nullopt; }
+
+				const foundation::convertor_manager_state state{dispatcher_->get_conversion_manager()};
+
+				bool has_candidate = false;
+				for (const auto& function: *functions)
+				{
+					if (function->arity_size() != foundation::function_proxy_base::no_parameters_arity)
+					{
+						if (function->arity_size() != static_cast<foundation::function_proxy_base::arity_size_type>(params.size())) { continue; }
+
+						// the same rule as the dispatcher, the arithmetic values can be converted to each other
+						if (not std::ranges::equal(
+								params,
+								function->type_view() | std::views::drop(1),
+								[&state](const auto& object, const auto& type) { return foundation::function_proxy_base::is_convertible(type, object, state) || (object.type_info().is_arithmetic() && type.is_arithmetic()); })) { continue; }
+					}
+
+					if (not function->has_attribute(foundation::function_attribute::pure | foundation::function_attribute::const_result)) { return std::nullopt; }
+					has_candidate = true;
+				}
+				if (not has_candidate) { return std::nullopt; }
+
+				try
+				{
+					if (auto result = foundation::dispatch(*functions, params, state);
+						is_propagable(result)) { return make_constant(result); }
+				}
+				catch (const std::exception&)
+				{
+					// let it fail at runtime
+				}
+
+				return std::nullopt;
+			}
+
+			// f(constants...) / "constant" + "constant" / constant.f(constants...)
+			[[nodiscard]] std::optional<foundation::boxed_value> call_pure(const ast::ast_node& node) const
+			{
+				foundation::parameters_type params{};
+				const auto push_constants = [&params](const ast::ast_node& arg_list)
+				{
+					return std::ranges::all_of(
+							arg_list.view(),
+							[&params](const auto& arg)
+							{
+								if (not arg.template is<ast::constant_ast_node>()) { return false; }
+								params.push_back(dynamic_cast<const ast::constant_ast_node&>(arg).value);
+								return true;
+							});
+				};
+
+				if (node.is<ast::fun_call_ast_node>() && node.size() == 2)
+				{
+					if (const auto& function = node.get_child(grammar::fun_call_ast_node::function_index);
+						function.is<ast::id_ast_node>() && push_constants(node.get_child(grammar::fun_call_ast_node::arg_list_index))) { return invoke_pure(function.identifier(), foundation::parameters_view_type{params}); }
+				}
+				else if (node.is<ast::binary_operator_ast_node>() && node.size() == 2)
+				{
+					// the arithmetic operations are folded by constant_fold_optimizer
+					if (push_constants(node) &&
+					    not std::ranges::all_of(params, [](const auto& param) { return param.type_info().is_arithmetic(); })) { return invoke_pure(node.identifier(), foundation::parameters_view_type{params}); }
+				}
+				else if (node.is<ast::dot_access_ast_node>())
+				{
+					// 'constant.f' without the parentheses may refer to a member, only the calls are folded
+					if (const auto& target = node.get_child(grammar::dot_access_ast_node::target_index),
+					               & function = node.get_child(grammar::dot_access_ast_node::function_index);
+						target.is<ast::constant_ast_node>() && function.is<ast::fun_call_ast_node>())
+					{
+						params.push_back(dynamic_cast<const ast::constant_ast_node&>(target).value);
+						if (function.size() <= 1 || push_constants(function.get_child(grammar::dot_access_ast_node::function_parameter_index))) { return invoke_pure(function.get_child(grammar::dot_access_ast_node::function_secondary_index).identifier(), foundation::parameters_view_type{params}); }
+					}
+				}
+
+				return std::nullopt;
+			}
+
+			/**
+			 * @brief Replace the calls of the pure functions with constant arguments by their results, return true if any node is replaced.
+			 */
+			bool fold_pure_calls(ast::ast_node_ptr& p, const bool into_function_body) const
+			{
+				bool changed = false;
+				for (decltype(p->size()) i = 0; i < p->size(); ++i) { changed |= fold_pure_calls(p->get_child_ptr(i), into_function_body); }
+
+				// the root of the function body is shared with the function (and the inlined calls), keep it
+				if (into_function_body) { for_each_body(*p, [this](auto& body) { for (decltype(body.size()) i = 0; i < body.size(); ++i) { (void)fold_pure_calls(body.get_child_ptr(i), true); } }); }
+
+				if (changed) { p = fold(std::move(p)); }
+
+				if (auto result = call_pure(*p))
+				{
+					p = std::move(*p).remake_node<ast::constant_ast_node>(*std::move(result));
+					return true;
+				}
+				return changed;
+			}
+
+		public:
+			void bind_dispatcher(const foundation::dispatcher& dispatcher) noexcept { dispatcher_ = &dispatcher; }
+
+			ast::ast_node_ptr operator()(ast::ast_node_ptr p)
+			{
+				if (p->is_any<ast::block_ast_node, ast::file_ast_node>()) { propagate_locals(*p); }
+
+				// the whole script is known, the immutable globals (that are not shadowed anywhere) can be folded
+				if (p->is<ast::file_ast_node>() && dispatcher_)
+				{
+					bound_names_.clear();
+					collect_bound_names(*p);
+
+					replaced_nodes_type replaced{};
+					std::unordered_map<identifier_type, std::optional<foundation::boxed_value>> globals{};
+					substitute_globals(*p, replaced, globals);
+
+					if (not replaced.empty())
+					{
+						for (decltype(p->size()) i = 0; i < p->size(); ++i) { (void)refold(p->get_child_ptr(i), replaced, true); }
+					}
+
+					// the calls of the pure functions with constant arguments (including the substituted globals)
+					for (decltype(p->size()) i = 0; i < p->size(); ++i) { (void)fold_pure_calls(p->get_child_ptr(i), true); }
+				}
+
+				return p;
+			}
+		};
+
+		struct last_use_optimizer
+		{
+		private:
+			using identifier_type = ast::ast_node::identifier_type;
+			using index_type = ast::ast_node::children_type::size_type;
+
+			const foundation::dispatcher* dispatcher_{nullptr};
+			// the functions and variables declared by the scripts parsed so far, a member function with the same name may be a script function
+			std::unordered_set<identifier_type> declared_names_;
+
+			template<typename Function>
+			static void for_each_body(ast::ast_node& node, Function function)
+			{
+				if (node.is<ast::def_ast_node>()) { if (auto& body = dynamic_cast<ast::def_ast_node&>(node).body_node) { function(*body); } }
+				else if (node.is<ast::method_ast_node>()) { if (auto& body = dynamic_cast<ast::method_ast_node&>(node).body_node) { function(*body); } }
+				else if (node.is<ast::lambda_ast_node>()) { if (auto& body = dynamic_cast<ast::lambda_ast_node&>(node).body_node()) { function(*body); } }
+			}
+
+			void collect_declared_names(ast::ast_node& node)
+			{
+				if (node.is_any<ast::def_ast_node, ast::method_ast_node>()) { declared_names_.insert(node.get_child(grammar::def_ast_node::function_name_index).identifier()); }
+				else if (node.is<ast::assign_decl_ast_node>()) { declared_names_.insert(node.get_child(grammar::assign_decl_ast_node::lhs_index).identifier()); }
+				else if (node.is<ast::var_decl_ast_node>()) { declared_names_.insert(node.get_child(grammar::var_decl_ast_node::index).identifier()); }
+
+				std::ranges::for_each(node.view(), [this](auto& child) { collect_declared_names(child); });
+				for_each_body(node, [this](auto& body) { collect_declared_names(body); });
+			}
+
+			// the child only reads the value (or assigns to it), it cannot keep a reference to it
+			[[nodiscard]] static bool is_reading(const ast::ast_node& parent, const index_type index) noexcept
+			{
+				if (parent.is_any<ast::binary_operator_ast_node, ast::fold_right_binary_operator_ast_node>()) { return is_reading_operation(foundation::algebraic_operation(parent.identifier())); }
+				if (parent.is<ast::unary_operator_ast_node>()) { return is_reading_operation(foundation::algebraic_operation(parent.identifier(), true)); }
+				if (parent.is_any<ast::logical_and_ast_node, ast::logical_or_ast_node>()) { return true; }
+				if (parent.is<ast::if_ast_node>()) { return index == grammar::if_ast_node::condition_index; }
+				if (parent.is<ast::while_ast_node>()) { return index == grammar::while_ast_node::condition_index; }
+				// the value is cloned
+				if (parent.is<ast::assign_decl_ast_node>()) { return index == grammar::assign_decl_ast_node::rhs_index; }
+				// the value is assigned to, but 'lhs := rhs' makes lhs share the object of rhs
+				if (parent.is<ast::equation_ast_node>()) { return index == grammar::equation_ast_node::lhs_index && parent.identifier() != foundation::operator_reference_assign_name::value; }
+				return false;
+			}
+
+			/**
+			 * @brief Every overload of the member function (visible at parse time) is a native function, and its result is a new value (or it is discarded).
+			 *
+			 * @note The native functions are trusted not to keep a reference to the object they are called on.
+			 */
+			[[nodiscard]] bool is_sealed_call(const identifier_type name, const bool result_discarded) const
+			{
+				if (not dispatcher_ || declared_names_.contains(name) || dispatcher_->find_object(name).has_value()) { return false; }
+
+				foundation::dispatcher::function_cache_location_type location{};
+				const auto& functions = dispatcher_->get_function(name, location);
+				if (not functions || functions->empty()) { return false; }
+
+				const auto attribute = result_discarded ? foundation::function_attribute::no_script_callback : foundation::function_attribute::no_script_callback | foundation::function_attribute::const_result;
+				return std::ranges::all_of(*functions, [attribute](const auto& function) { return function->has_attribute(attribute); });
+			}
+
+			/**
+			 * @brief Return true if nothing refers to the value of the local variable after the child is evaluated.
+			 */
+			[[nodiscard]] bool is_sealed(const ast::ast_node& parent, const index_type index, const identifier_type name) const
+			{
+				const auto& child = parent.get_child(index);
+
+				if (child.is<ast::compiled_ast_node>()) { return false; }
+				// a new stack, the variable is not visible
+				if (child.is_any<ast::def_ast_node, ast::method_ast_node, ast::class_decl_ast_node>()) { return true; }
+				// the lambda may capture it
+				if (child.is<ast::lambda_ast_node>()) { return not node_references(child, name); }
+
+				if (child.is<ast::id_ast_node>()) { return child.identifier() != name || is_reading(parent, index); }
+
+				const auto is_target = [name](const ast::ast_node& node, const index_type target_index)
+				{
+					const auto& target = node.get_child(target_index);
+					return target.is<ast::id_ast_node>() && target.identifier() == name;
+				};
+
+				// name[index], the element is shared by the clones anyway
+				if (child.is<ast::array_access_ast_node>() && is_target(child, grammar::array_access_ast_node::operation_target_index)) { return is_reading(parent, index) && is_sealed(child, grammar::array_access_ast_node::operation_parameter_index, name); }
+
+				// name.function(arguments)
+				if (child.is<ast::dot_access_ast_node>() && is_target(child, grammar::dot_access_ast_node::target_index))
+				{
+					const auto& function = child.get_child(grammar::dot_access_ast_node::function_index);
+					if (not function.is<ast::fun_call_ast_node>() ||
+					    not is_sealed_call(function.get_child(grammar::dot_access_ast_node::function_secondary_index).identifier(), parent.is_any<ast::block_ast_node, ast::no_scope_block_ast_node>())) { return false; }
+
+					return function.size() <= grammar::dot_access_ast_node::function_parameter_index || is_sealed(function, grammar::dot_access_ast_node::function_parameter_index, name);
+				}
+
+				for (index_type i = 0; i < child.size(); ++i) { if (not is_sealed(child, i, name)) { return false; } }
+				return true;
+			}
+
+			/**
+			 * @brief The read of the local variable by the statement, if it takes the value of the variable as a whole: 'var x = name', 'return name' or 'name' as the value of the block.
+			 */
+			[[nodiscard]] static ast::ast_node_ptr* find_last_read(ast::ast_node& scope, const index_type index, const identifier_type name)
+			{
+				const auto is_read = [name](const ast::ast_node_ptr& p) { return p->is<ast::id_ast_node>() && p->identifier() == name; };
+
+				auto& statement = scope.get_child_ptr(index);
+				if (is_read(statement) && index == scope.size() - 1) { return &statement; }
+
+				if (statement->is<ast::assign_decl_ast_node>())
+				{
+					if (auto& rhs = statement->get_child_ptr(grammar::assign_decl_ast_node::rhs_index); is_read(rhs)) { return &rhs; }
+				}
+				else if (statement->is<ast::return_ast_node>() && statement->size() == 1)
+				{
+					if (auto& operation = statement->get_child_ptr(grammar::return_ast_node::operation_index); is_read(operation)) { return &operation; }
+				}
+
+				return nullptr;
+			}
+
+			// var name = ...; ...; var x = name; => the value of 'name' is taken by 'x' (if nothing else refers to it)
+			void move_last_uses(ast::ast_node& scope) const
+			{
+				for (index_type i = 0; i < scope.size(); ++i)
+				{
+					const auto& decl = scope.get_child(i);
+					if (not decl.is<ast::assign_decl_ast_node>() || not decl.get_child(grammar::assign_decl_ast_node::lhs_index).is<ast::id_ast_node>()) { continue; }
+
+					const auto name = decl.get_child(grammar::assign_decl_ast_node::lhs_index).identifier();
+
+					// the last statement that refers to the variable
+					auto last = scope.size();
+					for (auto j = scope.size() - 1; j > i; --j)
+					{
+						if (node_references(scope.get_child(j), name))
+						{
+							last = j;
+							break;
+						}
+					}
+					if (last == scope.size()) { continue; }
+
+					auto* read = find_last_read(scope, last, name);
+					if (not read) { continue; }
+
+					bool sealed = true;
+					for (auto j = i + 1; j < last && sealed; ++j) { sealed = is_sealed(scope, j, name); }
+					if (not sealed) { continue; }
+
+					*read = std::move(**read).remake_node<ast::last_use_id_ast_node>();
+				}
+			}
+
+			void optimize_scopes(ast::ast_node& node) const
+			{
+				std::ranges::for_each(node.view(), [this](auto& child) { optimize_scopes(child); });
+				for_each_body(node, [this](auto& body) { optimize_scopes(body); });
+
+				// the variables of the file scope are still visible after the script is evaluated
+				if (node.is<ast::block_ast_node>()) { move_last_uses(node); }
+			}
+
+		public:
+			void bind_dispatcher(const foundation::dispatcher& dispatcher) noexcept { dispatcher_ = &dispatcher; }
+
+			ast::ast_node_ptr operator()(ast::ast_node_ptr p)
+			{
+				// the whole script is known, the script functions that may be called as members are known
+				if (p->is<ast::file_ast_node>())
+				{
+					collect_declared_names(*p);
+					optimize_scopes(*p);
+				}
+
+				return p;
+			}
+		};
+
+		struct tail_call_optimizer
+		{
+		private:
+			template<typename Pointer>
+			static void make_tail_call(Pointer& p) { p = std::move(*p).template remake_node<ast::tail_call_ast_node>(); }
+
+			// mark the 'return f(...)' inside the node (but not inside the nested functions, their tail calls are marked by themselves)
+			static void mark_returns(ast::ast_node& node)
+			{
+				// the tail call is made after the function returns, the 'finally' / 'catch' block would run before that
+				if (node.is_any<ast::def_ast_node, ast::method_ast_node, ast::lambda_ast_node, ast::class_decl_ast_node, ast::try_ast_node, ast::try_catch_ast_node, ast::try_finally_ast_node>()) { return; }
+
+				if (node.is<ast::return_ast_node>() && not node.empty())
+				{
+					if (auto& operation = node.get_child_ptr(grammar::return_ast_node::operation_index);
+						operation->is_any<ast::fun_call_ast_node, ast::unused_return_fun_call_ast_node>()) { make_tail_call(operation); }
+					return;
+				}
+
+				std::ranges::for_each(node.view(), [](auto& child) { mark_returns(child); });
+			}
+
+			// mark the node whose value is the result of the function
+			template<typename Pointer>
+			static void mark_tail(Pointer& p)
+			{
+				if (p->template is_any<ast::fun_call_ast_node, ast::unused_return_fun_call_ast_node>()) { make_tail_call(p); }
+				else if (p->template is_any<ast::block_ast_node, ast::no_scope_block_ast_node>() && not p->empty())
+				{
+					std::ranges::for_each(
+							p->front_view(static_cast<ast::ast_node::children_type::difference_type>(p->size()) - 1),
+							[](auto& child) { mark_returns(child); });
+					mark_tail(p->back_ptr());
+				}
+				else if (p->template is<ast::if_ast_node>())
+				{
+					mark_returns(p->get_child(grammar::if_ast_node::condition_index));
+					mark_tail(p->get_child_ptr(grammar::if_ast_node::true_branch_index));
+					mark_tail(p->get_child_ptr(grammar::if_ast_node::false_branch_index));
+				}
+				else { mark_returns(*p); }
+			}
+
+		public:
+			ast::ast_node_ptr operator()(ast::ast_node_ptr p) const
+			{
+				if (p->is<ast::def_ast_node>()) { mark_tail(dynamic_cast<ast::def_ast_node&>(*p).body_node); }
+				else if (p->is<ast::method_ast_node>()) { mark_tail(dynamic_cast<ast::method_ast_node&>(*p).body_node); }
+				else if (p->is<ast::lambda_ast_node>()) { mark_tail(dynamic_cast<ast::lambda_ast_node&>(*p).body_node()); }
+
+				return p;
+			}
+		};
+
+		struct inline_optimizer
+		{
+			// the maximum number of nodes of an inlined function body
+			constexpr static std::size_t max_inline_body_size = 24;
+
+		private:
+			struct inline_function
+			{
+				ast::inline_call_ast_node::shared_node_type body;
+				ast::inline_call_ast_node::param_names_type param_names;
+			};
+
+			// functions that are defined more than once (overloaded) or not suitable are kept as null
+			std::unordered_map<ast::ast_node::identifier_type, std::optional<inline_function>> functions_;
+
+			[[nodiscard]] static std::size_t body_size(const ast::ast_node& node)
+			{
+				std::size_t size = 1;
+				std::ranges::for_each(node.view(), [&size](const auto& child) { size += body_size(child); });
+				return size;
+			}
+
+			static void collect_declared_names(const ast::ast_node& node, std::unordered_set<ast::ast_node::identifier_type>& names)
+			{
+				if (node.is<ast::var_decl_ast_node>()) { names.insert(node.get_child(grammar::var_decl_ast_node::index).identifier()); }
+				else if (node.is<ast::reference_ast_node>()) { names.insert(node.get_child(grammar::reference_ast_node::identifier_index).identifier()); }
+				else if (node.is<ast::assign_decl_ast_node>()) { names.insert(node.get_child(grammar::assign_decl_ast_node::lhs_index).identifier()); }
+				else if (node.is_any<ast::ranged_for_ast_node, ast::counted_for_ast_node>()) { names.insert(node.get_child(grammar::ranged_for_ast_node::loop_variable_name_index).identifier()); }
+
+				std::ranges::for_each(node.view(), [&names](const auto& child) { collect_declared_names(child, names); });
+			}
+
+			/**
+			 * @brief The body only refers to its parameters and its own locals, it looks up no function or global by name,
+			 * so it can be evaluated in the stack of the caller without seeing the caller's locals.
+			 */
+			[[nodiscard]] static bool is_self_contained(const ast::ast_node& node, const std::unordered_set<ast::ast_node::identifier_type>& names)
+			{
+				// they capture the stack or leave work for the function that is returning
+				if (node.is_any<ast::lambda_ast_node, ast::def_ast_node, ast::method_ast_node, ast::class_decl_ast_node, ast::global_decl_ast_node, ast::tail_call_ast_node, ast::compiled_ast_node>()) { return false; }
+
+				if (node.is<ast::id_ast_node>()) { return names.contains(node.identifier()); }
+
+				if (node.is<ast::dot_access_ast_node>())
+				{
+					// the member name is looked up by the dispatcher, 'a.f(arguments)' still needs the arguments checked
+					const auto& function = node.get_child(grammar::dot_access_ast_node::function_index);
+					if (not is_self_contained(node.get_child(grammar::dot_access_ast_node::target_index), names)) { return false; }
+					if (function.is<ast::id_ast_node>()) { return true; }
+					return std::ranges::all_of(function.view() | std::views::drop(1), [&names](const auto& child) { return is_self_contained(child, names); });
+				}
+
+				return std::ranges::all_of(node.view(), [&names](const auto& child) { return is_self_contained(child, names); });
+			}
+
+			[[nodiscard]] static std::optional<inline_function> make_inline_function(ast::def_ast_node& def, const ast::ast_node::identifier_type name)
+			{
+				// the guard and the parameter types have to be checked by the dispatcher
+				if (def.guard_node || not def.body_node) { return std::nullopt; }
+
+				const auto& body = *def.body_node;
+				// any reference to the name (not only the calls) is considered recursive
+				if (body_size(body) > max_inline_body_size || node_references(body, name)) { return std::nullopt; }
+
+				ast::inline_call_ast_node::param_names_type param_names{};
+				if (def.size() > grammar::def_ast_node::arg_list_or_guard_or_body_index)
+				{
+					const auto& arg_list = def.get_child(grammar::def_ast_node::arg_list_or_guard_or_body_index);
+					gal_assert(arg_list.is<ast::arg_list_ast_node>());
+
+					for (const auto& arg: arg_list.view())
+					{
+						if (arg.size() > 1) { return std::nullopt; }
+						param_names.push_back(ast::arg_list_ast_node::get_arg_name(arg));
+					}
+				}
+
+				std::unordered_set<ast::ast_node::identifier_type> names{param_names.begin(), param_names.end()};
+				collect_declared_names(body, names);
+				if (not is_self_contained(body, names)) { return std::nullopt; }
+
+				return inline_function{.body = def.body_node, .param_names = std::move(param_names)};
+			}
+
+		public:
+			ast::ast_node_ptr operator()(ast::ast_node_ptr p)
+			{
+				if (p->is<ast::def_ast_node>())
+				{
+					auto& def = dynamic_cast<ast::def_ast_node&>(*p);
+					const auto name = def.get_child(grammar::def_ast_node::function_name_index).identifier();
+
+					if (const auto [it, inserted] = functions_.try_emplace(name, std::nullopt);
+						inserted) { it->second = make_inline_function(def, name); }
+					// overloaded
+					else { it->second.reset(); }
+				}
+				else if (
+					p->is<ast::fun_call_ast_node>() &&
+					p->get_child(grammar::fun_call_ast_node::function_index).is<ast::id_ast_node>())
+				{
+					// only the functions defined before the call are known
+					if (const auto it = functions_.find(p->get_child(grammar::fun_call_ast_node::function_index).identifier());
+						it != functions_.end() &&
+						it->second.has_value() &&
+						it->second->param_names.size() == p->get_child(grammar::fun_call_ast_node::arg_list_index).size())
+					{
+						// the call checks at runtime that the name still refers to this function
+						return std::move(*p).remake_node<ast::inline_call_ast_node>(it->second->body, it->second->param_names);
+					}
+				}
+
+				return p;
+			}
+		};
+
 		// todo: more optimizer
 	}// namespace optimizer_detail
 
 	using ast_optimizer = optimizer_detail::ast_optimizer<
 		optimizer_detail::return_optimizer,
 		optimizer_detail::block_optimizer,
+		optimizer_detail::constant_propagation_optimizer,
 		optimizer_detail::dead_code_optimizer,
 		optimizer_detail::unused_return_optimizer,
 		optimizer_detail::assign_decl_optimizer,
 		optimizer_detail::constant_if_optimizer,
 		optimizer_detail::binary_fold_optimizer,
-		optimizer_detail::constant_fold_optimizer
+		optimizer_detail::constant_fold_optimizer,
+		optimizer_detail::counted_for_optimizer,
+		// after counted_for_optimizer, the hoisted expressions belong to the final loop node
+		optimizer_detail::loop_invariant_optimizer,
+		optimizer_detail::constant_match_optimizer,
+		// after constant_propagation_optimizer, the reads of the constant locals are gone
+		optimizer_detail::last_use_optimizer,
+		optimizer_detail::tail_call_optimizer,
+		// after tail_call_optimizer, it may replace the body of the function
+		optimizer_detail::inline_optimizer
 	>;
 };
 
@@ -2311,8 +2311,8 @@ namespace gal::lang::addon
 		/**
 		 * @brief Reads (and potentially captures) a quoted string from input.
 		 * Translates escaped sequences.
+		 * Interpolated strings are built as a single string_interpolation_ast_node.
 		 *
-		 * @todo Need to be optimized
 		 * @todo format?
 		 *
 		 * @throw exception::eval_error throw from skip_whitespace()
@@ -2328,7 +2328,7 @@ namespace gal::lang::addon
 			{
 				types::string_type match{};
 				const auto prev_size = match_stack_.size();
-				const auto is_interpolated = [&match, &begin, prev_size, this]
+				const auto is_interpolated = [&match, &begin, this]
 				{
 					char_parser p{match, true};
 
@@ -2338,13 +2338,8 @@ namespace gal::lang::addon
 						{
 							if (b.peek() == '{')
 							{
-								// We've found an interpolation point
-								match_stack_.emplace_back(this->make_node<ast::constant_ast_node>(match.data(), begin, const_var(match)));
-								if (p.is_interpolated)
-								{
-									// If we've seen previous interpolation, add on instead of making a new one
-									build_match<ast::binary_operator_ast_node>(prev_size, foundation::operator_plus_name::value);
-								}
+								// We've found an interpolation point, all parts will be joined by string_interpolation_ast_node
+								if (not match.empty()) { match_stack_.emplace_back(this->make_node<ast::constant_ast_node>(match.data(), begin, const_var(match))); }
 
 								// We've finished with the part of the string up to this point, so clear it
 								match.clear();
@@ -2359,10 +2354,7 @@ namespace gal::lang::addon
 									p.is_interpolated = true;
 									++b;
 
-									const auto to_string_size = match_stack_.size();
-									match_stack_.emplace_back(this->make_node<ast::id_ast_node>(foundation::operator_to_string_name::value, begin));
-
-									const auto eval_size = match_stack_.size();
+									// the evaluated part will be converted to string by string_interpolation_ast_node
 									try { match_stack_.emplace_back(parse_instruct_eval(eval_string)); }
 									catch (const exception::eval_error& ex)
 									{
@@ -2371,10 +2363,6 @@ namespace gal::lang::addon
 												filename_,
 												begin};
 									}
-
-									build_match<ast::arg_list_ast_node>(eval_size);
-									build_match<ast::fun_call_ast_node>(to_string_size);
-									build_match<ast::binary_operator_ast_node>(prev_size, foundation::operator_plus_name::value);
 								}
 								else
 								{
@@ -2399,8 +2387,12 @@ namespace gal::lang::addon
 					return p.is_interpolated;
 				}();
 
-				match_stack_.push_back(this->make_node<ast::constant_ast_node>(match.data(), begin, const_var(match)));
-				if (is_interpolated) { build_match<ast::binary_operator_ast_node>(prev_size, foundation::operator_plus_name::value); }
+				if (is_interpolated)
+				{
+					if (not match.empty()) { match_stack_.push_back(this->make_node<ast::constant_ast_node>(match.data(), begin, const_var(match))); }
+					build_match<ast::string_interpolation_ast_node>(prev_size);
+				}
+				else { match_stack_.push_back(this->make_node<ast::constant_ast_node>(match.data(), begin, const_var(match))); }
 
 				return true;
 			}
@@ -68,14 +68,14 @@ namespace gal::lang
 
 	inline foundation::boxed_value void_var()
 	{
-		const static foundation::boxed_value v{foundation::boxed_value::void_type{}};
+		const GAL_UTILS_SHARED_HANDLE_STATIC foundation::boxed_value v{foundation::boxed_value::void_type{}};
 		return v;
 	}
 
 	inline foundation::boxed_value const_var(const bool b)
 	{
-		const static foundation::boxed_value t{boxed_value_detail::make_const_boxed_value(true)};
-		const static foundation::boxed_value f{boxed_value_detail::make_const_boxed_value(false)};
+		const GAL_UTILS_SHARED_HANDLE_STATIC foundation::boxed_value t{boxed_value_detail::make_const_boxed_value(true)};
+		const GAL_UTILS_SHARED_HANDLE_STATIC foundation::boxed_value f{boxed_value_detail::make_const_boxed_value(false)};
 
 		return b ? t : f;
 	}
@@ -8,7 +8,7 @@
 #ifdef _MSC_VER
 #define GAL_LANG_MODULE_EXPORT extern "C" __declspec(dllexport)
 #else
-	#define GAL_LANG_MODULE_EXPORT extern "C"
+	#define GAL_LANG_MODULE_EXPORT extern "C" EXPORTED_SYMBOL
 #endif
 
 
@@ -392,6 +392,11 @@ namespace gal::lang
 			constexpr ast_optimizer_base& operator=(ast_optimizer_base&&) = default;
 
 			[[nodiscard]] virtual ast_node_ptr optimize(ast_node_ptr node) = 0;
+
+			/**
+			 * @brief Let the optimizer look up the dispatcher (such as the immutable globals) while parsing.
+			 */
+			virtual void bind_dispatcher(const foundation::dispatcher& dispatcher) { (void)dispatcher; }
 		};
 
 		class ast_parser_base
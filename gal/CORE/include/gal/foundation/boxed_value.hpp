@@ -5,11 +5,37 @@
 
 #include <gal/foundation/type_info.hpp>
 #include <any>
+#include <new>
+#include <algorithm>
+#include <vector>
+#include <utils/hash.hpp>
+#include <utils/reference_count.hpp>
+
+// define GAL_LANG_CYCLE_COLLECTOR to track the objects examined by the cycle collector (see cycle_collector.hpp),
+// it observes them through weak handles, which the non-atomic handles do not have
+#if defined(GAL_LANG_CYCLE_COLLECTOR) and defined(GAL_UTILS_NO_ATOMIC_REFERENCE_COUNT)
+	#error "GAL_LANG_CYCLE_COLLECTOR cannot be used with GAL_UTILS_NO_ATOMIC_REFERENCE_COUNT"
+#endif
 
 namespace gal::lang::foundation
 {
+	class boxed_value;
+	class cycle_collector;
+
+	/**
+	 * @brief A type whose objects own other boxed_values, so they may be part of a reference cycle (see cycle_collector).
+	 */
+	template<typename T>
+	concept traceable = requires(const T& object, T& mutable_object, std::vector<const boxed_value*>& children)
+	{
+		object.trace(children);
+		mutable_object.clear();
+	};
+
 	class boxed_value
 	{
+		friend class cycle_collector;
+
 		struct internal_data;
 
 	public:
@@ -21,7 +47,8 @@ namespace gal::lang::foundation
 		// for build a internal type boxed_value
 		struct internal_flag_construction_tag { };
 
-		using internal_data_type = std::shared_ptr<internal_data>;
+		// not atomic if GAL_UTILS_NO_ATOMIC_REFERENCE_COUNT is defined (see utils/reference_count.hpp)
+		using internal_data_type = utils::shared_handle<internal_data>;
 
 		static const gal_type_info& class_type() noexcept
 		{
@@ -30,12 +57,37 @@ namespace gal::lang::foundation
 		}
 
 	private:
+		/**
+		 * @brief How the cycle collector sees a traceable object held by a std::shared_ptr<T> in internal_data::data.
+		 */
+		struct object_tracer
+		{
+			using children_type = std::vector<const boxed_value*>;
+
+			void (*trace)(const void* object, children_type& children);
+			void (*clear)(void* object);
+			// the number of owners of the object, not the number of boxed_value referring to it
+			long (*owners)(const std::any& data);
+			std::size_t object_size;
+
+			template<typename T>
+			[[nodiscard]] static const object_tracer* of() noexcept
+			{
+				static constexpr object_tracer t{
+						[](const void* object, children_type& children) { static_cast<const T*>(object)->trace(children); },
+						[](void* object) { static_cast<T*>(object)->clear(); },
+						[](const std::any& data) { return std::any_cast<std::shared_ptr<T>>(&data)->use_count(); },
+						sizeof(T)};
+				return &t;
+			}
+		};
+
 		/**
 		 * @brief structure which holds the internal state of a boxed_value
 		 *
 		 * @todo get rid of any and merge it with this, reducing an allocation in the process
 		 */
-		struct internal_data
+		struct internal_data : utils::shared_handle_base
 		{
 			using data_type = std::any;
 
@@ -48,6 +100,13 @@ namespace gal::lang::foundation
 			bool is_reference;
 			bool is_xvalue;
 
+			#ifdef GAL_LANG_CYCLE_COLLECTOR
+			// null if the object cannot refer to other boxed_values
+			const object_tracer* tracer{nullptr};
+			// this internal_data is in the tracked_objects of its thread
+			bool tracked{false};
+			#endif
+
 			internal_data(
 					const gal_type_info type,
 					data_type data,
@@ -70,11 +129,68 @@ namespace gal::lang::foundation
 			~internal_data() noexcept = default;
 		};
 
+		/**
+		 * @brief The internal_data of the traceable objects created by this thread, observed by the cycle collector.
+		 */
+		struct tracked_objects
+		{
+			#ifdef GAL_LANG_CYCLE_COLLECTOR
+			using weak_data_type = utils::weak_handle<internal_data>;
+			using container_type = std::vector<weak_data_type>;
+
+			// a weak handle keeps the storage of the (dead) internal_data, so the expired ones are dropped when the container doubles
+			constexpr static container_type::size_type min_prune_size = 64;
+
+			container_type objects;
+			container_type::size_type prune_size = min_prune_size;
+
+			[[nodiscard]] static tracked_objects& instance() noexcept
+			{
+				thread_local tracked_objects objects{};
+				return objects;
+			}
+
+			void prune() noexcept
+			{
+				std::erase_if(objects, [](const weak_data_type& object) { return object.expired(); });
+				prune_size = std::ranges::max(min_prune_size, objects.size() * 2);
+			}
+
+			// if the allocation fails the object is not tracked, the collector never examines it
+			void track(const internal_data_type& data) noexcept
+			{
+				if (data->tracked) { return; }
+
+				try
+				{
+					if (objects.size() >= prune_size) { prune(); }
+					objects.emplace_back(data);
+					data->tracked = true;
+				}
+				catch (const std::bad_alloc&) { }
+			}
+			#endif
+		};
+
 		struct internal_data_factory
 		{
+			template<typename T>
+			static internal_data_type track(internal_data_type data)
+			{
+				#ifdef GAL_LANG_CYCLE_COLLECTOR
+				// a const object cannot be changed to refer to itself, it is treated as a root
+				if constexpr (traceable<T>)
+				{
+					data->tracer = object_tracer::of<T>();
+					tracked_objects::instance().track(data);
+				}
+				#endif
+				return data;
+			}
+
 			static auto make()
 			{
-				return std::make_shared<internal_data>(
+				return utils::make_shared_handle<internal_data>(
 						make_invalid_type_type(),
 						internal_data::data_type{},
 						nullptr,
@@ -84,7 +200,7 @@ namespace gal::lang::foundation
 
 			static auto make(const gal_type_info::flag_type flag, internal_flag_construction_tag)
 			{
-				return std::make_shared<internal_data>(
+				return utils::make_shared_handle<internal_data>(
 						make_internal_type_type(flag),
 						internal_data::data_type{},
 						nullptr,
@@ -94,7 +210,7 @@ namespace gal::lang::foundation
 
 			static auto make(void_type, const bool is_xvalue)
 			{
-				return std::make_shared<internal_data>(
+				return utils::make_shared_handle<internal_data>(
 						make_type_info<void_type::type>(),
 						internal_data::data_type{},
 						nullptr,
@@ -105,31 +221,31 @@ namespace gal::lang::foundation
 			template<typename T>
 			static auto make(const std::shared_ptr<T>& data, const bool is_xvalue)
 			{
-				return std::make_shared<internal_data>(
+				return track<T>(utils::make_shared_handle<internal_data>(
 						make_type_info<T>(),
 						internal_data::data_type{data},
 						data.get(),
 						false,
-						is_xvalue);
+						is_xvalue));
 			}
 
 			template<typename T>
 			static auto make(std::shared_ptr<T>&& data, const bool is_xvalue)
 			{
 				auto raw = data.get();
-				return std::make_shared<internal_data>(
+				return track<T>(utils::make_shared_handle<internal_data>(
 						make_type_info<T>(),
 						internal_data::data_type{std::move(data)},
 						raw,
 						false,
-						is_xvalue);
+						is_xvalue));
 			}
 
 			template<typename T>
 			static auto make(std::unique_ptr<T>&& data, const bool is_xvalue)
 			{
 				auto raw = data.get();
-				return std::make_shared<internal_data>(
+				return utils::make_shared_handle<internal_data>(
 						make_type_info<T>(),
 						internal_data::data_type{std::make_shared<std::unique_ptr<T>>(std::move(data))},
 						raw,
@@ -150,7 +266,7 @@ namespace gal::lang::foundation
 			static auto make(std::reference_wrapper<T> data, const bool is_xvalue)
 			{
 				auto& real = data.get();
-				return std::make_shared<internal_data>(
+				return utils::make_shared_handle<internal_data>(
 						make_type_info<T>(),
 						internal_data::data_type{std::move(data)},
 						&real,
@@ -195,7 +311,16 @@ namespace gal::lang::foundation
 		 */
 		boxed_value& assign(const boxed_value& other) noexcept
 		{
+			#ifdef GAL_LANG_CYCLE_COLLECTOR
+			// whether data_ is tracked does not change with its value
+			const auto tracked = data_->tracked;
 			*data_ = *other.data_;
+			data_->tracked = tracked;
+			// data_ may hold a traceable object now
+			if (data_->tracer) { tracked_objects::instance().track(data_); }
+			#else
+			*data_ = *other.data_;
+			#endif
 			return *this;
 		}
 
@@ -220,6 +345,8 @@ namespace gal::lang::foundation
 
 		void to_lvalue() const noexcept { data_->is_xvalue = false; }
 
+		void to_xvalue() const noexcept { data_->is_xvalue = true; }
+
 		/**
 		 * @brief return true if object's bare type equal
 		 */
@@ -292,7 +419,7 @@ namespace gal::lang::foundation
 		// todo: boxed_value need a safe and efficient way to get its state
 		[[nodiscard]] auto use_count() const noexcept { return data_.use_count(); }
 
-		[[nodiscard]] std::size_t hash() const noexcept { return std::hash<internal_data_type>{}(data_); }
+		[[nodiscard]] std::size_t hash() const noexcept { return static_cast<std::size_t>(utils::hash_wyhash(reinterpret_cast<std::uintptr_t>(data_.get()))); }
 	};
 }
 
@@ -0,0 +1,246 @@
+#pragma once
+
+#ifndef GAL_LANG_FOUNDATION_CYCLE_COLLECTOR_HPP
+#define GAL_LANG_FOUNDATION_CYCLE_COLLECTOR_HPP
+
+/**
+ * @file cycle_collector.hpp
+ *
+ * @details The collector is optional. The traceable objects are only tracked if the compiler definition GAL_LANG_CYCLE_COLLECTOR
+ * is defined (it cannot be used with GAL_UTILS_NO_ATOMIC_REFERENCE_COUNT), otherwise cycle_collector::collect never reclaims anything.
+ */
+
+#include <limits>
+#include <vector>
+#include <unordered_map>
+#include <gal/foundation/boxed_value.hpp>
+
+namespace gal::lang::foundation
+{
+	/**
+	 * @brief Reclaims the traceable objects (list, dict, dynamic_object) which are only kept alive by a reference cycle.
+	 *
+	 * @details Trial deletion: for a set of tracked objects, the references coming from inside the set are subtracted
+	 * from their reference counts, the objects that still have a reference are reachable from outside, and so are the
+	 * objects they refer to. The rest is garbage, they are cleared, which breaks the cycles and lets the reference
+	 * counts free them.
+	 * Any subset of the objects gives a correct (if incomplete) answer, so a step can be bounded by a budget,
+	 * the next step continues with the objects after the ones this step started from.
+	 *
+	 * @note Only the objects created by the calling thread are examined, and none of them may be used by another thread
+	 * during the collection.
+	 */
+	class cycle_collector
+	{
+	public:
+		using size_type = std::size_t;
+
+		struct result_type
+		{
+			// the number of objects reclaimed
+			size_type objects;
+			// an estimate of the memory reclaimed (the objects and their element slots, not what the elements own)
+			size_type bytes;
+		};
+
+		constexpr static size_type unlimited_budget = std::numeric_limits<size_type>::max();
+
+	private:
+		// where the next step starts in the tracked objects
+		size_type cursor_{0};
+
+		#ifdef GAL_LANG_CYCLE_COLLECTOR
+		using internal_data = boxed_value::internal_data;
+		using internal_data_type = boxed_value::internal_data_type;
+		using tracked_objects = boxed_value::tracked_objects;
+		using children_type = boxed_value::object_tracer::children_type;
+
+		struct node_type
+		{
+			// keeps the object alive during the collection
+			internal_data_type data;
+			// the nodes this node refers to
+			std::vector<size_type> children;
+			// references from outside of the examined objects, a reachable node has a positive value
+			long external_references;
+			size_type element_count;
+		};
+
+		class graph_type
+		{
+		public:
+			std::vector<node_type> nodes;
+
+		private:
+			std::unordered_map<const internal_data*, size_type> indices_;
+			std::vector<children_type> edges_;
+
+			// the boxed_values owned by the object, or nothing if someone else also owns it
+			[[nodiscard]] static children_type trace(const internal_data& data)
+			{
+				children_type children{};
+				if (data.tracer->owners(data.data) == 1) { data.tracer->trace(data.const_raw, children); }
+				return children;
+			}
+
+		public:
+			[[nodiscard]] bool contains(const internal_data& data) const { return indices_.contains(&data); }
+
+			/**
+			 * @brief Add data and the traceable objects reachable from it, until the graph has budget nodes.
+			 */
+			void add(internal_data_type data, const size_type budget)
+			{
+				auto pending = nodes.size();
+				indices_.emplace(data.get(), nodes.size());
+				nodes.push_back({.data = std::move(data), .children = {}, .external_references = 0, .element_count = 0});
+
+				for (; pending != nodes.size(); ++pending)
+				{
+					auto& edges = edges_.emplace_back(trace(*nodes[pending].data));
+					nodes[pending].element_count = edges.size();
+
+					for (const auto* child: edges)
+					{
+						if (nodes.size() >= budget) { return; }
+						if (not child->data_->tracer || contains(*child->data_)) { continue; }
+
+						indices_.emplace(child->data_.get(), nodes.size());
+						nodes.push_back({.data = child->data_, .children = {}, .external_references = 0, .element_count = 0});
+					}
+				}
+			}
+
+			/**
+			 * @brief Count the references to each node from outside of the graph.
+			 */
+			void count_references()
+			{
+				// the nodes whose edges were not traced (out of budget) are treated as roots, their edges are not subtracted
+				edges_.resize(nodes.size());
+
+				for (auto& node: nodes)
+				{
+					// the handle in node.data is ours
+					node.external_references = node.data.use_count() - 1;
+				}
+
+				for (size_type i = 0; i < nodes.size(); ++i)
+				{
+					for (const auto* child: edges_[i])
+					{
+						if (const auto it = indices_.find(child->data_.get()); it != indices_.end())
+						{
+							nodes[i].children.push_back(it->second);
+							--nodes[it->second].external_references;
+						}
+					}
+				}
+
+				// someone else owns the object itself, we cannot see their references
+				for (auto& node: nodes) { if (node.data->tracer->owners(node.data->data) != 1) { node.external_references = 1; } }
+			}
+
+			/**
+			 * @brief Mark the nodes reachable from outside, the unmarked nodes are garbage.
+			 */
+			[[nodiscard]] std::vector<bool> mark_reachable() const
+			{
+				std::vector<bool> reachable(nodes.size(), false);
+				std::vector<size_type> pending{};
+
+				for (size_type i = 0; i < nodes.size(); ++i)
+				{
+					if (nodes[i].external_references > 0)
+					{
+						reachable[i] = true;
+						pending.push_back(i);
+					}
+				}
+
+				while (not pending.empty())
+				{
+					const auto i = pending.back();
+					pending.pop_back();
+
+					for (const auto child: nodes[i].children)
+					{
+						if (not reachable[child])
+						{
+							reachable[child] = true;
+							pending.push_back(child);
+						}
+					}
+				}
+
+				return reachable;
+			}
+		};
+		#endif
+
+	public:
+		/**
+		 * @brief The number of objects tracked by the calling thread, including the dead ones which are not dropped yet.
+		 */
+		[[nodiscard]] static size_type tracked() noexcept
+		{
+			#ifdef GAL_LANG_CYCLE_COLLECTOR
+			return tracked_objects::instance().objects.size();
+			#else
+			return 0;
+			#endif
+		}
+
+		/**
+		 * @brief Examine at most budget tracked objects (and the objects they refer to) and reclaim the unreachable ones.
+		 */
+		result_type collect(const size_type budget = unlimited_budget)
+		{
+			#ifdef GAL_LANG_CYCLE_COLLECTOR
+			auto& tracked = tracked_objects::instance();
+			if (budget == unlimited_budget)
+			{
+				tracked.prune();
+				cursor_ = 0;
+			}
+
+			auto& objects = tracked.objects;
+			if (objects.empty() || budget == 0) { return {.objects = 0, .bytes = 0}; }
+
+			graph_type graph{};
+			if (cursor_ >= objects.size()) { cursor_ = 0; }
+
+			// every object is a seed once per round, unless the budget runs out
+			for (size_type seen = 0; seen < objects.size() && graph.nodes.size() < budget; ++seen)
+			{
+				if (auto data = objects[cursor_].lock(); data && not graph.contains(*data)) { graph.add(std::move(data), budget); }
+				cursor_ = (cursor_ + 1) % objects.size();
+			}
+
+			graph.count_references();
+			const auto reachable = graph.mark_reachable();
+
+			result_type result{.objects = 0, .bytes = 0};
+			for (size_type i = 0; i < graph.nodes.size(); ++i)
+			{
+				if (reachable[i]) { continue; }
+
+				auto& data = *graph.nodes[i].data;
+				++result.objects;
+				result.bytes += sizeof(internal_data) + data.tracer->object_size + graph.nodes[i].element_count * sizeof(boxed_value);
+
+				// all nodes are kept alive by the graph, clearing one does not free another one yet
+				data.tracer->clear(const_cast<void*>(data.const_raw));
+			}
+
+			// the cycles are broken, the garbage is freed with the graph
+			return result;
+			#else
+			(void)budget;
+			return {.objects = 0, .bytes = 0};
+			#endif
+		}
+	};
+}
+
+#endif // GAL_LANG_FOUNDATION_CYCLE_COLLECTOR_HPP
@@ -10,6 +10,10 @@
 #include <gal/foundation/string_pool.hpp>
 #include <gal/foundation/name.hpp>
 #include <utils/utility_base.hpp>
+#include <utils/hash.hpp>
+#include <atomic>
+#include <deque>
+#include <optional>
 
 namespace gal::lang
 {
@@ -97,6 +101,23 @@ namespace gal::lang
 
 			[[nodiscard]] foundation::string_view_type which() const noexcept { return name_; }
 		};
+
+		class global_immutable_error final : public std::runtime_error
+		{
+		private:
+			foundation::string_type name_;
+
+		public:
+			explicit global_immutable_error(foundation::string_type name)
+				: std::runtime_error{
+						  std_format::format("global variable '{}' is immutable and cannot be reassigned", name)},
+				  name_{std::move(name)} {}
+
+			explicit global_immutable_error(const foundation::string_view_type name)
+				: global_immutable_error{foundation::string_type{name}} {}
+
+			[[nodiscard]] foundation::string_view_type which() const noexcept { return name_; }
+		};
 	}// namespace exception
 
 	namespace foundation
@@ -110,8 +131,8 @@ namespace gal::lang
 		public:
 			// name <=> type_info
 			using type_infos_type = std::map<string_view_type, gal_type_info, std::less<>>;
-			// name <=> function
-			using functions_type = std::multimap<string_view_type, function_proxy_type, std::less<>>;
+			// name <=> functions (overload set, in the order of registration)
+			using functions_type = std::map<string_view_type, function_proxies_type, std::less<>>;
 			// name <=> "global" object
 			// note: module level object is global visible
 			using objects_type = std::map<string_view_type, boxed_value, std::less<>>;
@@ -134,14 +155,15 @@ namespace gal::lang
 			convertors_type convertors_;
 
 			template<typename Map>
-			void reinsert_node(Map& map, typename Map::const_iterator it)
+			typename Map::iterator reinsert_node(Map& map, typename Map::const_iterator it)
 			{
-				const auto insert_target = std::ranges::prev(it);
+				// the hint is the element after the node (the node may be the first element)
+				const auto insert_target = std::ranges::next(it);
 				auto node = map.extract(it);
 				// put the name into the string pool
 				node.key() = pool_.append(node.key());
 				// the value of the key has not changed, so we expect the in-place insert
-				map.insert(insert_target, std::move(node));
+				return map.insert(insert_target, std::move(node));
 			}
 
 		public:
@@ -186,9 +208,13 @@ namespace gal::lang
 				return *this;
 			}
 
+			/**
+			 * @param attributes The effects of the function (see function_attribute), the optimizer relies on them.
+			 */
 			engine_module& add_function(
 					const string_view_type name,
-					function_proxy_type function
+					function_proxy_type function,
+					const function_attribute attributes = function_attribute::none
 					GAL_LANG_RECODE_CALL_LOCATION_DEBUG_DO(
 							,
 							const std_source_location& location = std_source_location::current()))
@@ -203,24 +229,15 @@ namespace gal::lang
 							name,
 							functions_.contains(name) ? "there are already some functions with the same name" : "this is the first function of this name");)
 
-				if (const auto it = functions_.find(name);
-					// already exist
-					it != functions_.end())
-				{
-					functions_.emplace_hint(
-							it,
-							// reuse the same name
-							it->first,
-							std::move(function));
-				}
-				else
+				// the functions of the same name are grouped together, the dispatcher builds the overload set once when loading the module
+				auto [it, inserted] = functions_.try_emplace(name);
+				if (inserted)
 				{
-					// not exist
-					functions_.emplace(
-							// put the name into string pool
-							pool_.append(name),
-							std::move(function));
+					// not exist, replace the key
+					it = reinsert_node(functions_, it);
 				}
+				function->add_attributes(attributes);
+				it->second.emplace_back(std::move(function));
 
 				return *this;
 			}
@@ -327,17 +344,6 @@ namespace gal::lang
 							});
 						utils::logger::debug("There are currently {} type_info(s), details:\n\t{}", types_.size(), type_info_detail);)
 
-				std::ranges::for_each(
-						types_,
-						[&dispatcher](const auto& type)
-						{
-							try { dispatcher.add_type_info(type.first, type.second); }
-							catch (const exception::name_conflict_error&)
-							{
-								// todo: Should we throw an error if there's a name conflict while applying a module?
-							}
-						});
-
 				//*********************
 				//****  FUNCTION  ****
 				//*********************
@@ -352,21 +358,6 @@ namespace gal::lang
 							});
 						utils::logger::debug("There are currently {} function(s), details:\n\t{}", functions_.size(), function_detail);)
 
-				std::ranges::for_each(
-						functions_,
-						[&dispatcher](auto&& function)
-						{
-							try
-							{
-								if constexpr (Takeover) { dispatcher.add_function(function.first, std::move(function.second)); }
-								else { dispatcher.add_function(function.first, function.second); }
-							}
-							catch (const exception::name_conflict_error&)
-							{
-								// todo: Should we throw an error if there's a name conflict while applying a module?
-							}
-						});
-
 				//*******************
 				//****  OBJECT  ****
 				//*******************
@@ -381,12 +372,23 @@ namespace gal::lang
 							});
 						utils::logger::debug("There are currently {} object(s), details:\n\t{}", objects_.size(), object_detail);)
 
+				// build each overload set once and publish them all together
+				if constexpr (Takeover) { dispatcher.add_module(types_, std::move(functions_), std::move(objects_)); }
+				else { dispatcher.add_module(types_, functions_, objects_); }
+
+				//************************
+				//****  CONVERTOR  ****
+				//************************
+
+				GAL_LANG_RECODE_CALL_LOCATION_DEBUG_DO(
+						utils::logger::debug("There are currently {} convertors(s)", convertors_.size());)
+
 				std::ranges::for_each(
-						objects_,
-						[&dispatcher](auto&& object)
+						convertors_,
+						[&dispatcher]<typename Convertor>(Convertor&& convertor)
 						{
-							if constexpr (Takeover) { dispatcher.add_global(object.first, std::move(object.second)); }
-							else { dispatcher.add_global(object.first, object.second); }
+							if constexpr (Takeover) { dispatcher.add_convertor(std::forward<Convertor>(convertor)); }
+							else { dispatcher.add_convertor(convertor); }
 						});
 
 				//************************
@@ -407,21 +409,6 @@ namespace gal::lang
 						evaluations_,
 						[&engine](auto&& evaluation) { (void)engine.eval(evaluation); });
 
-				//************************
-				//****  CONVERTOR  ****
-				//************************
-
-				GAL_LANG_RECODE_CALL_LOCATION_DEBUG_DO(
-						utils::logger::debug("There are currently {} convertors(s)", convertors_.size());)
-
-				std::ranges::for_each(
-						convertors_,
-						[&dispatcher]<typename Convertor>(Convertor&& convertor)
-						{
-							if constexpr (Takeover) { dispatcher.add_convertor(std::forward<Convertor>(convertor)); }
-							else { dispatcher.add_convertor(convertor); }
-						});
-
 				if constexpr (Takeover) { dispatcher.takeover_pool(std::move(pool_)); }
 				else {}
 			}
@@ -551,6 +538,17 @@ namespace gal::lang
 
 			using call_depth_type = int;
 
+			/**
+			 * @brief A call in tail position, it is made by the caller of the current function instead of recursing (see ast::tail_call_ast_node).
+			 */
+			struct tail_call_type
+			{
+				boxed_value function;
+				parameters_type params;
+				// for error reporting
+				const ast::ast_node* function_node;
+			};
+
 			using scope_location_type = std::uint_fast32_t;
 			constexpr static scope_location_type scope_location_not_exist = 0;
 
@@ -574,6 +572,11 @@ namespace gal::lang
 			parameters_list_type parameters_list;
 			call_depth_type depth;
 
+			// the pending tail call of the current function
+			std::optional<tail_call_type> tail_call;
+			// the functions called at this location (stacks.size(), depth) are called by a trampoline, they leave their tail calls pending
+			std::pair<stacks_type::size_type, call_depth_type> trampoline_location;
+
 			[[nodiscard]] stack_type& recent_stack() noexcept { return stacks.back(); }
 
 			[[nodiscard]] const stack_type& recent_stack() const noexcept { return stacks.back(); }
@@ -615,6 +618,13 @@ namespace gal::lang
 				borrowed_block_.pop_back();
 			}
 
+			void reset_scope()
+			{
+				// the names of the objects stay in the borrowed block, they are reused by the objects added later (see add_object_no_check)
+				recent_scope().clear();
+				recent_call().clear();
+			}
+
 			void prepare_new_call() { parameters_list.emplace_back(); }
 
 			void finish_call() { parameters_list.pop_back(); }
@@ -622,7 +632,8 @@ namespace gal::lang
 		public:
 			explicit engine_stack(string_pool_type& pool)
 				: borrowed_pool_{pool},
-				  depth{0}
+				  depth{0},
+				  trampoline_location{0, 0}
 			{
 				prepare_new_stack();
 				prepare_new_call();
@@ -630,6 +641,8 @@ namespace gal::lang
 
 			[[nodiscard]] constexpr bool is_root() const noexcept { return depth == 0; }
 
+			[[nodiscard]] bool is_trampoline_location() const noexcept { return trampoline_location.first == stacks.size() && trampoline_location.second == depth; }
+
 			/**
 			 * @brief Pushes a new stack on to the list of stacks.
 			 */
@@ -692,6 +705,26 @@ namespace gal::lang
 				prepare_new_call();
 			}
 
+			/**
+			 * @brief Removes all objects in the current scope, the scope can be reused without popping and pushing it again.
+			 */
+			void clear_scope(
+					GAL_LANG_RECODE_CALL_LOCATION_DEBUG_DO(
+							const std::string_view reason = "no reason",
+							const std_source_location& location = std_source_location::current()))
+			{
+				GAL_LANG_RECODE_CALL_LOCATION_DEBUG_DO(
+						utils::logger::info("'{}' from (file: '{}' function: '{}' position: ({}:{})), try to clear a scope because '{}'",
+							__func__,
+							location.file_name(),
+							location.function_name(),
+							location.line(),
+							location.column(),
+							reason);)
+
+				reset_scope();
+			}
+
 			/**
 			 * @brief Pops the current scope from the stack.
 			 */
@@ -743,7 +776,13 @@ namespace gal::lang
 				// 	it == scope.end()) { return scope.emplace(recent_borrowed_block().append(name), std::move(object)).first->second; }
 				// new code
 				if (const auto it = std::ranges::find(scope | std::views::keys, name);
-					it == std::ranges::end(scope | std::views::keys)) { return scope.emplace_back(recent_borrowed_block().append(name), std::move(object)).second; }
+					it == std::ranges::end(scope | std::views::keys))
+				{
+					auto& block = recent_borrowed_block();
+					// the scope has been cleared (see clear_scope), the name may already be borrowed
+					const auto borrowed = block.size() > scope.size() ? block.find(name) : string_view_type{};
+					return scope.emplace_back(borrowed.empty() ? block.append(name) : borrowed, std::move(object)).second;
+				}
 
 				throw exception::name_conflict_error{name};
 			}
@@ -823,8 +862,14 @@ namespace gal::lang
 				current_call.insert(current_call.end(), std::make_move_iterator(params.begin()), std::make_move_iterator(params.end()));
 			}
 
-			void push_params(
-					const parameters_view_type params
+			/**
+			 * @brief Keeps the temporary arguments of a finished call alive until the current scope ends, the result of the call may refer to them.
+			 * The arguments that are also owned by someone else (a variable, a constant, the result itself...) are borrowed, the temporaries are moved.
+			 *
+			 * @note Call it after the call is made, the arguments are left moved-from.
+			 */
+			void save_params(
+					const std::span<boxed_value> params
 					GAL_LANG_RECODE_CALL_LOCATION_DEBUG_DO(
 							,
 							const std_source_location& location = std_source_location::current()))
@@ -839,7 +884,9 @@ namespace gal::lang
 							params.size());)
 
 				auto& current_call = recent_call();
-				current_call.insert(current_call.end(), params.begin(), params.end());
+				std::ranges::for_each(
+						params,
+						[&current_call](auto& param) { if (param.use_count() == 1) { current_call.push_back(std::move(param)); } });
 			}
 
 			void pop_params(
@@ -1027,6 +1074,183 @@ namespace gal::lang
 			void do_destruct() const;
 		};
 
+		/**
+		 * @brief Open addressing (linear probing) hash table of the functions, keyed by the names in the string pool.
+		 *
+		 * @note Every name has a stable id (the address of its entry), the entry never moves or be removed,
+		 * the content of it follows the changes of the overload set.
+		 */
+		class function_table
+		{
+		public:
+			struct function_pack
+			{
+				std::shared_ptr<function_proxies_type> overloaded;
+				function_proxy_type dispatched;
+				boxed_value boxed;
+			};
+
+			struct entry_type
+			{
+				string_view_type name;
+				function_pack pack;
+				// increased every time the overload set changes
+				std::atomic<std::size_t> version;
+
+				explicit entry_type(const string_view_type name)
+					: name{name},
+					  pack{std::make_shared<function_proxies_type>(), {}, {}},
+					  version{0} {}
+			};
+
+			using function_id_type = const entry_type*;
+
+		private:
+			struct slot_type
+			{
+				std::size_t hash;
+				entry_type* entry;
+			};
+
+			constexpr static std::size_t initial_capacity = 256;
+
+			// the size is always a power of 2
+			std::vector<slot_type> slots_;
+			// entries never move
+			std::deque<entry_type> entries_;
+			// increased every time an entry is created or an overload set changes, so that a name which was not found can be looked up again
+			std::atomic<std::size_t> generation_{0};
+
+			[[nodiscard]] static std::size_t hash_of(const string_view_type name) noexcept { return utils::string_hasher{}(name); }
+
+			[[nodiscard]] std::size_t mask() const noexcept { return slots_.size() - 1; }
+
+			[[nodiscard]] entry_type* find(const string_view_type name, const std::size_t hash) const noexcept
+			{
+				if (slots_.empty()) { return nullptr; }
+
+				for (auto index = hash & mask();; index = (index + 1) & mask())
+				{
+					const auto [slot_hash, entry] = slots_[index];
+					if (entry == nullptr) { return nullptr; }
+
+					// the names are interned, compare the pointer first
+					if (slot_hash == hash && ((entry->name.data() == name.data() && entry->name.size() == name.size()) || entry->name == name)) { return entry; }
+				}
+			}
+
+			void rehash(const std::size_t capacity)
+			{
+				std::vector<slot_type> slots(capacity, slot_type{0, nullptr});
+
+				// the hash of the name is stored, no need to hash it again
+				std::ranges::for_each(
+						slots_,
+						[&slots, mask = capacity - 1](const slot_type& slot)
+						{
+							if (slot.entry == nullptr) { return; }
+
+							auto index = slot.hash & mask;
+							while (slots[index].entry != nullptr) { index = (index + 1) & mask; }
+							slots[index] = slot;
+						});
+
+				slots_.swap(slots);
+			}
+
+		public:
+			[[nodiscard]] std::size_t size() const noexcept { return entries_.size(); }
+
+			[[nodiscard]] std::size_t generation() const noexcept { return generation_.load(std::memory_order_acquire); }
+
+			/**
+			 * @brief Let the function caches know the overload set of the entry changed.
+			 */
+			void mark_changed(entry_type& entry) noexcept
+			{
+				entry.version.fetch_add(1, std::memory_order_release);
+				generation_.fetch_add(1, std::memory_order_release);
+			}
+
+			/**
+			 * @brief Find the entry of the name, return nullptr if not found.
+			 *
+			 * @note The entry may have an empty overload set, see find_or_create.
+			 */
+			[[nodiscard]] entry_type* find(const string_view_type name) const noexcept { return find(name, hash_of(name)); }
+
+			/**
+			 * @brief Whether the name has a non-empty overload set.
+			 */
+			[[nodiscard]] bool contains(const string_view_type name) const noexcept
+			{
+				const auto* entry = find(name);
+				return entry && not entry->pack.overloaded->empty();
+			}
+
+			/**
+			 * @brief Find the entry of the name, create an entry with empty overload set if not found.
+			 *
+			 * @note The name will be stored in the pool if the entry is created.
+			 */
+			entry_type& find_or_create(const string_view_type name, string_pool_type& pool)
+			{
+				const auto hash = hash_of(name);
+				if (auto* entry = find(name, hash)) { return *entry; }
+
+				// keep the load factor no more than 0.5
+				if ((entries_.size() + 1) * 2 > slots_.size()) { rehash(std::ranges::max(initial_capacity, slots_.size() * 2)); }
+
+				auto& entry = entries_.emplace_back(pool.append(name));
+
+				auto index = hash & mask();
+				while (slots_[index].entry != nullptr) { index = (index + 1) & mask(); }
+				slots_[index] = {hash, &entry};
+				generation_.fetch_add(1, std::memory_order_release);
+
+				return entry;
+			}
+		};
+
+		/**
+		 * @brief The cache of a function call site, holds the stable id of the function name and a snapshot of its overload set.
+		 * The snapshot will be refreshed once the overload set changes.
+		 */
+		class function_cache
+		{
+			friend class dispatcher;
+
+			struct snapshot_type
+			{
+				// null if the name was not found
+				function_table::function_id_type id;
+				// the version of the entry, or the generation of the table if the name was not found
+				std::size_t version;
+				std::shared_ptr<function_proxies_type> functions;
+			};
+
+			// the call sites are shared by all the threads evaluating the same script, the snapshot is replaced as a whole
+			std::atomic<std::shared_ptr<const snapshot_type>> snapshot_{};
+
+		public:
+			function_cache() noexcept = default;
+
+			function_cache(const function_cache& other) noexcept
+				: snapshot_{other.snapshot_.load(std::memory_order_acquire)} {}
+
+			function_cache& operator=(const function_cache& other) noexcept
+			{
+				snapshot_.store(other.snapshot_.load(std::memory_order_acquire), std::memory_order_release);
+				return *this;
+			}
+
+			[[nodiscard]] function_table::function_id_type id() const noexcept
+			{
+				const auto snapshot = snapshot_.load(std::memory_order_acquire);
+				return snapshot ? snapshot->id : nullptr;
+			}
+		};
+
 		/**
 		 * @brief Main class for the dispatch kits.
 		 * Handles management of the object stack, functions and registered types.
@@ -1042,19 +1266,14 @@ namespace gal::lang
 			// using object_cache_location_type = std::optional<boxed_value>;
 			// new code
 			using object_cache_location_type = std::atomic<engine_stack::scope_location_type>;
-			// todo: the lifetime of our cached location may be longer than the actual object (such as returning an empty smart pointer and then automatically destroying it after use)
-			using function_cache_location_type = std::optional<std::shared_ptr<function_proxies_type>>;
+			using function_cache_location_type = function_cache;
 
 			using type_infos_type = engine_module::type_infos_type;
 
-			struct function_pack
-			{
-				std::shared_ptr<dispatch_function::functions_type> overloaded;
-				function_proxy_type dispatched;
-				boxed_value boxed;
-			};
+			using function_pack = function_table::function_pack;
+			using function_id_type = function_table::function_id_type;
 
-			using functions_type = std::map<string_view_type, function_pack, std::less<>>;
+			using functions_type = function_table;
 
 			using objects_type = engine_module::objects_type;
 
@@ -1063,6 +1282,8 @@ namespace gal::lang
 				type_infos_type types;
 				functions_type functions;
 				objects_type global_objects;
+				// the globals which can never be reassigned, the optimizer may fold them into the scripts
+				std::set<string_view_type, std::less<>> immutable_globals;
 			};
 
 		private:
@@ -1136,6 +1357,28 @@ namespace gal::lang
 				}
 			};
 
+			/**
+			 * @brief Replace the overload set of the entry, the functions should be sorted.
+			 */
+			void publish_functions(function_table::entry_type& entry, function_proxies_type&& functions)
+			{
+				auto& [overloaded, dispatched, boxed] = entry.pack;
+
+				overloaded = std::make_shared<function_proxies_type>(functions);
+
+				if (functions.size() == 1 && not functions.front()->has_arithmetic_param()) { dispatched = std::move(functions.front()); }
+				else
+				{
+					// if the function is the only function, but it also contains
+					// arithmetic operators, we must wrap it in a dispatch function
+					// to allow for automatic arithmetic type conversions
+					dispatched = std::make_shared<dispatch_function>(std::move(functions));
+				}
+
+				boxed = const_var(dispatched);
+				state_.functions.mark_changed(entry);
+			}
+
 		public:
 			explicit dispatcher(string_pool_type& pool, ast::ast_parser_base& p)
 				: parser_{p},
@@ -1184,11 +1427,14 @@ namespace gal::lang
 			/**
 			 * @brief Add a new named function_proxy to the system.
 			 *
+			 * @param attributes The effects of the function (see function_attribute), the optimizer relies on them.
+			 *
 			 * @throw exception::name_conflict_error if there's a function matching the given one being added.
 			 */
 			void add_function(
 					const string_view_type name,
-					function_proxy_type function
+					function_proxy_type function,
+					const function_attribute attributes = function_attribute::none
 					GAL_LANG_RECODE_CALL_LOCATION_DEBUG_DO(
 							,
 							const std_source_location& location = std_source_location::current()))
@@ -1205,53 +1451,91 @@ namespace gal::lang
 							name,
 							state_.functions.contains(name) ? "but it was already exist" : "add successed");)
 
-				string_view_type pool_name = name;
+				// the entry may already exist (registered or referenced by function id) but with an empty overload set
+				auto& entry = state_.functions.find_or_create(name, borrowed_pool_.get());
+				const auto& overloaded = *entry.pack.overloaded;
 
-				auto function_object = [&pool_name, this]<typename Fun>(Fun&& func) -> function_proxy_type
-				{
-					auto& functions = state_.functions;
+				// name already registered
+				if (std::ranges::any_of(overloaded, [&function](const auto& f) { return *function == *f; })) { throw exception::name_conflict_error{entry.name}; }
 
-					if (const auto it = functions.find(pool_name);
-						it != functions.end())
-					{
-						// name already registered
-						if (std::ranges::any_of(*it->second.overloaded, [&func](const auto& f) { return *func == *f; })) { throw exception::name_conflict_error{pool_name}; }
+				function->add_attributes(attributes);
 
-						auto copy_fs = *it->second.overloaded;
-						// tightly control vec growth
-						copy_fs.reserve(1 + copy_fs.size());
-						copy_fs.emplace_back(std::forward<Fun>(func));
-						std::ranges::stable_sort(copy_fs, function_comparator{});
+				auto copy_fs = overloaded;
+				// tightly control vec growth
+				copy_fs.reserve(1 + copy_fs.size());
+				copy_fs.emplace_back(std::move(function));
+				if (copy_fs.size() != 1) { std::ranges::stable_sort(copy_fs, function_comparator{}); }
 
-						it->second.overloaded = std::make_shared<std::decay_t<decltype(copy_fs)>>(copy_fs);
-						return std::make_shared<dispatch_function>(std::move(copy_fs));
-					}
-					else
-					{
-						// need register name
-						pool_name = borrowed_pool_.get().append(pool_name);
+				publish_functions(entry, std::move(copy_fs));
+			}
+
+			/**
+			 * @brief Add all type_info, function and global object of a module at once.
+			 * Each affected overload set is sorted and rebuilt only once, all of them are published under a single lock.
+			 *
+			 * @note The type_info and function which already exist will be skipped (same as adding them one by one),
+			 * but nothing will be added if any of the global object already exists.
+			 *
+			 * @throw exception::name_conflict_error if there's a global object with the same name.
+			 */
+			void add_module(
+					const type_infos_type& types,
+					engine_module::functions_type functions,
+					objects_type objects)
+			{
+				utils::threading::unique_lock lock{mutex_};
+
+				// check the objects first, we do not want a half loaded module
+				if (const auto it = std::ranges::find_if(
+							objects,
+							[this](const auto& object) { return state_.global_objects.contains(object.first); });
+					it != objects.end()) { throw exception::name_conflict_error{it->first}; }
+
+				auto& pool = borrowed_pool_.get();
+
+				std::ranges::for_each(
+						types,
+						[this, &pool](const auto& type)
+						{
+							if (const auto it = state_.types.find(type.first);
+								it == state_.types.end()) { state_.types.emplace_hint(it, pool.append(type.first), type.second); }
+						});
 
-						if (func->has_arithmetic_param())
+				std::ranges::for_each(
+						functions,
+						[this, &pool](auto& pair)
 						{
-							// if the function is the only function, but it also contains
-							// arithmetic operators, we must wrap it in a dispatch function
-							// to allow for automatic arithmetic type conversions
-							std::decay_t<decltype(*it->second.overloaded)> fs;
-							fs.reserve(1);
-							fs.emplace_back(std::forward<Fun>(func));
-							functions.emplace(pool_name, std::make_shared<std::decay_t<decltype(fs)>>(fs));
-							return std::make_shared<dispatch_function>(std::move(fs));
-						}
-						auto fs = std::make_shared<std::decay_t<decltype(*it->second.overloaded)>>();
-						fs->emplace_back(func);
-						functions.emplace(pool_name, fs);
-						return func;
-					}
-				}(std::move(function));
+							auto& [name, fs] = pair;
+
+							auto& entry = state_.functions.find_or_create(name, pool);
+							const auto& overloaded = *entry.pack.overloaded;
 
-				auto& [_, dispatched, boxed] = state_.functions[pool_name];
-				boxed = const_var(function_object);
-				dispatched = std::move(function_object);
+							function_proxies_type copy_fs;
+							// tightly control vec growth
+							copy_fs.reserve(overloaded.size() + fs.size());
+							copy_fs.insert(copy_fs.end(), overloaded.begin(), overloaded.end());
+
+							std::ranges::for_each(
+									fs,
+									[&copy_fs](auto& function)
+									{
+										// name conflict, pass
+										if (std::ranges::any_of(copy_fs, [&function](const auto& f) { return *function == *f; })) { return; }
+
+										copy_fs.emplace_back(std::move(function));
+									});
+
+							// nothing changed
+							if (copy_fs.size() == overloaded.size()) { return; }
+
+							if (copy_fs.size() != 1) { std::ranges::stable_sort(copy_fs, function_comparator{}); }
+
+							publish_functions(entry, std::move(copy_fs));
+						});
+
+				std::ranges::for_each(
+						objects,
+						[this, &pool](auto& object) { state_.global_objects.emplace(pool.append(object.first), std::move(object.second)); });
 			}
 
 			/**
@@ -1370,11 +1654,78 @@ namespace gal::lang
 							name,
 							state_.global_objects.contains(name) ? "but it was already exist, assign it" : "add successed");)
 
+				if (state_.immutable_globals.contains(name)) { throw exception::global_immutable_error{name}; }
+
 				if (const auto it = state_.global_objects.find(name);
 					it != state_.global_objects.end()) { return it->second = std::move(object); }
 				else { return state_.global_objects.emplace_hint(it, borrowed_pool_.get().append(name), std::move(object))->second; }
 			}
 
+			/**
+			 * @brief Adds a new global (const) shared object which can never be reassigned, between all the threads.
+			 *
+			 * @note Unlike add_global, the value may be folded into the scripts when they are parsed.
+			 *
+			 * @throw global_mutable_error object is not const
+			 * @throw name_conflict_error object already exist
+			 */
+			boxed_value& add_global_immutable(const string_view_type name, boxed_value object)
+			{
+				if (not object.is_const()) { throw exception::global_mutable_error{name}; }
+
+				utils::threading::unique_lock lock{mutex_};
+
+				if (const auto it = state_.global_objects.find(name);
+					it == state_.global_objects.end())
+				{
+					const auto result = state_.global_objects.emplace_hint(it, borrowed_pool_.get().append(name), std::move(object));
+					state_.immutable_globals.insert(result->first);
+					return result->second;
+				}
+
+				throw exception::name_conflict_error{name};
+			}
+
+			/**
+			 * @brief Return the global object if it was added by add_global_immutable and no local object (in the current stack) hides it.
+			 */
+			[[nodiscard]] std::optional<boxed_value> get_immutable_global(const string_view_type name) const
+			{
+				if (find_local(name).has_value()) { return std::nullopt; }
+
+				utils::threading::shared_lock lock{mutex_};
+
+				if (not state_.immutable_globals.contains(name)) { return std::nullopt; }
+				return state_.global_objects.find(name)->second;
+			}
+
+			/**
+			 * @brief Return the local object (in the current stack) of the name.
+			 */
+			[[nodiscard]] std::optional<boxed_value> find_local(const string_view_type name) const
+			{
+				for (const auto& scope: stack_->recent_stack() | std::views::reverse)
+				{
+					if (const auto it = std::ranges::find(scope | std::views::keys, name);
+						it != std::ranges::end(scope | std::views::keys)) { return it.base()->second; }
+				}
+				return std::nullopt;
+			}
+
+			/**
+			 * @brief Return the local (in the current stack) or global object of the name, the functions are not included.
+			 */
+			[[nodiscard]] std::optional<boxed_value> find_object(const string_view_type name) const
+			{
+				if (auto object = find_local(name)) { return object; }
+
+				utils::threading::shared_lock lock{mutex_};
+
+				if (const auto it = state_.global_objects.find(name);
+					it != state_.global_objects.end()) { return it->second; }
+				return std::nullopt;
+			}
+
 			/**
 			 * @brief Set the value of an object, by name. If the object
 			 * is not available in the current scope it is created.
@@ -1585,15 +1936,13 @@ namespace gal::lang
 			 */
 			[[nodiscard]] boxed_value& get_function_object(const string_view_type name, object_cache_location_type& cache_location)
 			{
-				auto& functions = state_.functions;
-
-				if (const auto it = functions.find(name);
-					it != functions.end())
+				if (auto* entry = state_.functions.find(name);
+					entry && not entry->pack.overloaded->empty())
 				{
 					// changed since 0.5.4, see engine_stack::scope_type
 					// cache_location.emplace(it->second.boxed);
 					(void)cache_location;
-					return it->second.boxed;
+					return entry->pack.boxed;
 				}
 				throw std::range_error{"object not found"};
 			}
@@ -1634,20 +1983,67 @@ namespace gal::lang
 							name,
 							not state_.functions.contains(name) ? "but it was not exist" : "found it");)
 
-				const auto& functions = state_.functions;
-				if (const auto it = functions.find(name); it != functions.end()) { return it->second.overloaded; }
-				else { return std::make_shared<std::decay_t<decltype(it->second.overloaded)>::element_type>(); }
+				if (const auto* entry = state_.functions.find(name)) { return entry->pack.overloaded; }
+				return std::make_shared<function_proxies_type>();
+			}
+
+			/**
+			 * @brief Return the stable id of the function name, it stays valid (and follows the changes of the overload set) as long as the dispatcher exists.
+			 *
+			 * @note If the function does not exist yet, an entry with empty overload set will be created, it will be filled when the function is added.
+			 */
+			[[nodiscard]] function_id_type get_function_id(const string_view_type name)
+			{
+				utils::threading::unique_lock lock{mutex_};
+
+				return &state_.functions.find_or_create(name, borrowed_pool_.get());
+			}
+
+			/**
+			 * @brief Return the current overload set of the function id.
+			 */
+			[[nodiscard]] std::shared_ptr<function_proxies_type> get_function(const function_id_type id) const
+			{
+				utils::threading::shared_lock lock{mutex_};
+
+				return id->pack.overloaded;
 			}
 
-			[[nodiscard]] auto get_method_missing_functions() const
+			/**
+			 * @brief Return a function by name, the result will be cached in cache_location.
+			 *
+			 * @note The cache will be refreshed if the overload set changes, or (if the function does not exist) once a new name is added.
+			 */
+			[[nodiscard]] std::shared_ptr<function_proxies_type> get_function(const string_view_type name, function_cache_location_type& cache_location) const
 			{
-				if (method_missing_location_.has_value()) { return *method_missing_location_; }
+				// fast path, nothing changed since last time
+				if (const auto snapshot = cache_location.snapshot_.load(std::memory_order_acquire);
+					snapshot && snapshot->version == (snapshot->id ? snapshot->id->version.load(std::memory_order_acquire) : state_.functions.generation())) { return snapshot->functions; }
+
+				static const auto no_functions = std::make_shared<function_proxies_type>();
+
+				utils::threading::shared_lock lock{mutex_};
+
+				auto snapshot = [this, name]() -> std::shared_ptr<const function_cache::snapshot_type>
+				{
+					// read the generation first, a name added after it will be found next time
+					const auto generation = state_.functions.generation();
+					if (const auto* entry = state_.functions.find(name)) { return std::make_shared<const function_cache::snapshot_type>(entry, entry->version.load(std::memory_order_acquire), entry->pack.overloaded); }
+					return std::make_shared<const function_cache::snapshot_type>(nullptr, generation, no_functions);
+				}();
 
-				auto result = get_function(dynamic_object::missing_method_name);
-				method_missing_location_.emplace(result);
-				return result;
+				auto functions = snapshot->functions;
+				cache_location.snapshot_.store(std::move(snapshot), std::memory_order_release);
+				return functions;
 			}
 
+			/**
+			 * @brief Increased every time a function name is added or an overload set changes.
+			 */
+			[[nodiscard]] std::size_t functions_generation() const noexcept { return state_.functions.generation(); }
+
+			[[nodiscard]] auto get_method_missing_functions() const { return get_function(dynamic_object::missing_method_name, method_missing_location_); }
+
 			/**
 			 * @brief Returns true if a call can be made that consists of the first
 			 * parameter (the function) with the remaining parameters as its arguments.
@@ -1744,13 +2140,7 @@ namespace gal::lang
 							name,
 							params.size());)
 
-				decltype(get_function(name)) functions;
-				if (cache_location.has_value()) { functions = *cache_location; }
-				else
-				{
-					functions = get_function(name);
-					cache_location.emplace(functions);
-				}
+				const auto functions = get_function(name, cache_location);
 
 				const convertor_manager_state cms{convertor_manager_};
 
@@ -1803,7 +2193,7 @@ namespace gal::lang
 
 				const auto missing_functions = [this, params, &cms]
 				{
-					decltype(get_method_missing_functions())::element_type ret{};
+					function_proxies_type ret{};
 
 					const auto mmf = get_method_missing_functions();
 
@@ -1867,11 +2257,8 @@ namespace gal::lang
 
 				const convertor_manager_state state{convertor_manager_};
 
-				if (cache_location.has_value()) { return dispatch(**cache_location, params, state); }
-
-				auto functions = get_function(name);
-				cache_location.emplace(functions);
-
+				// hold the overload set, the cache may be refreshed by the nested calls
+				const auto functions = get_function(name, cache_location);
 				return dispatch(*functions, params, state);
 			}
 
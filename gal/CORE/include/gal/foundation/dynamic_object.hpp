@@ -5,6 +5,8 @@
 
 #include<gal/foundation/boxed_value.hpp>
 #include <unordered_map>
+#include <vector>
+#include <utils/hash.hpp>
 
 namespace gal::lang::foundation
 {
@@ -13,7 +15,7 @@ namespace gal::lang::foundation
 	public:
 		constexpr static string_view_type missing_method_name = GAL_LANG_FUNCTION_METHOD_MISSING_NAME;
 
-		using members_type = std::unordered_map<string_view_type, boxed_value, std::hash<string_view_type>, std::equal_to<>>;
+		using members_type = std::unordered_map<string_view_type, boxed_value, utils::string_hasher, std::equal_to<>>;
 
 		static const gal_type_info& class_type() noexcept
 		{
@@ -53,6 +55,15 @@ namespace gal::lang::foundation
 
 		bool del_attr(const string_view_type name) { return members_.erase(name); }
 
+		// drop all members, for the cycle collector (see cycle_collector)
+		void clear() noexcept { members_.clear(); }
+
+		// append the members to children, for the cycle collector (see cycle_collector)
+		void trace(std::vector<const boxed_value*>& children) const
+		{
+			for (const auto& [_, member]: members_) { children.push_back(&member); }
+		}
+
 		/**
 		 * @brief A function of the signature method_missing(object, name, param1, param2, param3) will be called if an appropriate method cannot be found.
 		 *
@@ -3,13 +3,24 @@
 #ifndef GAL_LANG_LANGUAGE_ENGINE_HPP
 #define GAL_LANG_LANGUAGE_ENGINE_HPP
 
-// todo
+#if defined(_WIN32) || defined(__CYGWIN__)
 #define GAL_LANG_WINDOWS
+#elif defined(__unix__) || defined(__APPLE__)
+#define GAL_LANG_POSIX
+#else
+#error "Binary module is not supported on this platform"
+#endif
 
 #include <fstream>
 #include <gal/exception_handler.hpp>
 #include <gal/foundation/ast.hpp>
+#include <gal/foundation/function_handle.hpp>
+#include <gal/foundation/cycle_collector.hpp>
+#ifdef GAL_LANG_WINDOWS
 #include <gal/plugins/binary_module_windows.hpp>
+#else
+#include <gal/plugins/binary_module_posix.hpp>
+#endif
 #include <gal/foundation/string_pool.hpp>
 #include <gal/function_register.hpp>
 
@@ -56,6 +67,8 @@ namespace gal::lang::foundation
 		std::unique_ptr<ast::ast_parser_base> parser_;
 		dispatcher dispatcher_;
 
+		cycle_collector cycle_collector_;
+
 		[[nodiscard]] static file_content_type load_file(const std::string_view filename)
 		{
 			std::ifstream file{filename.data(), std::ios::in | std::ios::ate | std::ios::binary};
@@ -330,7 +343,11 @@ namespace gal::lang::foundation
 				preloaded_paths_type preloaded_paths)
 			: preloaded_paths_{std::move(preloaded_paths)},
 			  parser_{std::move(parser)},
-			  dispatcher_{string_pool_, *parser_} { build_system(std::move(library)); }
+			  dispatcher_{string_pool_, *parser_}
+		{
+			parser_->get_optimizer().bind_dispatcher(dispatcher_);
+			build_system(std::move(library));
+		}
 
 		[[nodiscard]] boxed_value eval(ast::ast_node& node)
 		{
@@ -458,13 +475,42 @@ namespace gal::lang::foundation
 
 		/**
 		 * @brief Add a new named proxy_function to the system.
+		 *
+		 * @param attributes The effects of the function (see function_attribute), the optimizer relies on them.
+		 *
+		 * @code
+		 * engine.add_function("distance", fun(&distance), function_attribute::pure | function_attribute::const_result);
+		 * @endcode
 		 */
-		engine_base& add_function(const string_view_type name, function_proxy_type function)
+		engine_base& add_function(const string_view_type name, function_proxy_type function, const function_attribute attributes = function_attribute::none)
 		{
-			dispatcher_.add_function(name, std::move(function));
+			dispatcher_.add_function(name, std::move(function), attributes);
 			return *this;
 		}
 
+		/**
+		 * @brief Get a callable handle of a function, the overload is resolved once (and again if the overload set changes).
+		 *
+		 * @code
+		 * const auto f = engine.get_function<double(int, const std::string&)>("f");
+		 * const auto result = f(42, "hello");
+		 * @endcode
+		 */
+		template<typename FunctionSignature>
+		[[nodiscard]] function_handle<FunctionSignature> get_function(const string_view_type name) { return {dispatcher_, dispatcher_.get_function_id(name)}; }
+
+		/**
+		 * @brief Call the function once for each group of arguments, the per-call overhead (scope, parameter buffer, overload resolution) is paid once for the whole batch.
+		 *
+		 * @code
+		 * const auto score = engine.get_function<double(const item&)>("score");
+		 * std::vector<double> scores(items.size());
+		 * engine.call_batch(score, std::span{scores}, std::span{items});
+		 * @endcode
+		 */
+		template<typename FunctionSignature, typename... Spans>
+		void call_batch(const function_handle<FunctionSignature>& handle, Spans&&... spans) const { handle.call_batch(std::forward<Spans>(spans)...); }
+
 		/**
 		 * @brief Adds a constant object that is available in all contexts and to all threads
 		 *
@@ -480,6 +526,22 @@ namespace gal::lang::foundation
 			return *this;
 		}
 
+		/**
+		 * @brief Adds a constant object that is available in all contexts and to all threads and can never be reassigned,
+		 * the scripts parsed later may have its value folded into them.
+		 *
+		 * @param name Name of the value to add
+		 * @param object boxed_value to add as a global
+		 *
+		 * @throw global_mutable_error variable is not const
+		 */
+		engine_base& add_global_immutable(const string_view_type name, boxed_value object)
+		{
+			name_validator::validate_object_name(name);
+			dispatcher_.add_global_immutable(name, std::move(object));
+			return *this;
+		}
+
 		/**
 		 * @brief Add a new convertor for up-casting to a base class.
 		 */
@@ -547,6 +609,21 @@ namespace gal::lang::foundation
 
 		template<typename T>
 		[[nodiscard]] string_view_type nameof() const { return this->nameof(foundation::make_type_info<T>()); }
+
+		/**
+		 * @brief Reclaim the lists, dicts and objects created by this thread which are only kept alive by a reference cycle.
+		 *
+		 * @param budget The maximum number of objects examined, the next call continues where this one stopped.
+		 * A small budget bounds the pause, calling it repeatedly eventually examines all objects.
+		 *
+		 * @note The objects are only tracked if GAL_LANG_CYCLE_COLLECTOR is defined, otherwise nothing is reclaimed.
+		 *
+		 * @code
+		 * engine.eval("{ var a = []; a.push_back(a); }");
+		 * const auto [objects, bytes] = engine.collect();
+		 * @endcode
+		 */
+		cycle_collector::result_type collect(const cycle_collector::size_type budget = cycle_collector::unlimited_budget) { return cycle_collector_.collect(budget); }
 	};
 }
 
@@ -12,8 +12,12 @@
 #include <gal/foundation/boxed_exception.hpp>
 #include <gal/types/range_type.hpp>
 #include <gal/types/string_type.hpp>
+#include <gal/types/string_view_type.hpp>
 #include <gal/types/list_type.hpp>
 #include <gal/types/dict_type.hpp>
+#include <array>
+#include <functional>
+#include <optional>
 
 namespace gal::lang
 {
@@ -22,6 +26,55 @@ namespace gal::lang
 	 */
 	namespace eval_detail
 	{
+		/**
+		 * @brief Make the pending tail calls one by one, the callees leave their own tail calls pending so the stack does not grow.
+		 */
+		[[nodiscard]] inline foundation::boxed_value eval_tail_calls(const foundation::dispatcher_state& state);
+
+		/**
+		 * @brief The object bound to 'this' in the called function, the object of the recent scope (if any) or the first param.
+		 */
+		[[nodiscard]] inline const foundation::boxed_value* find_object_this(const foundation::dispatcher_state& state, const foundation::parameters_view_type params)
+		{
+			auto& scope = state.stack().recent_scope();
+			// changed since 0.5.4, see engine_stack::scope_type
+			// if (const auto it = scope.find(foundation::object_self_type_name::value);
+			// 	it != scope.end()) { return &it->second; }
+			// new code
+			if (const auto it = std::ranges::find(scope | std::views::keys, foundation::object_self_type_name::value);
+				it != std::ranges::end(scope | std::views::keys)) { return &it.base()->second; }
+
+			if (not params.empty()) { return &params.front(); }
+			return nullptr;
+		}
+
+		/**
+		 * @brief Bind 'this', the captured locals and the params in the recent scope.
+		 *
+		 * @note The id_ast_node of the body caches the slots of the locals, every way of calling the body must bind them in the same order.
+		 */
+		template<typename Range>
+			requires std::is_convertible_v<std::ranges::range_value_t<Range>, ast::ast_node::identifier_type>
+		void bind_function_locals(
+				const foundation::dispatcher_state& state,
+				const foundation::boxed_value* object_this,
+				const foundation::parameters_view_type params,
+				const Range& param_names,
+				const foundation::engine_stack::scope_type& locals = {},
+				const bool is_this_capture = false)
+		{
+			if (object_this && not is_this_capture) { state->add_local_or_throw(foundation::object_self_name::value, *object_this); }
+
+			std::ranges::for_each(
+					locals,
+					[&state](const auto& pair) { state->add_local_or_throw(pair.first, pair.second); });
+
+			utils::zip_invoke(
+					[&state](const auto& name, const auto& object) { if (name != foundation::object_self_name::value) { state->add_local_or_throw(name, object); } },
+					param_names,
+					params.begin());
+		}
+
 		template<typename Range>
 			requires std::is_convertible_v<std::ranges::range_value_t<Range>, ast::ast_node::identifier_type>
 		[[nodiscard]] foundation::boxed_value eval_function(
@@ -37,34 +90,22 @@ namespace gal::lang
 
 			foundation::dispatcher_state state{dispatcher};
 
-			const auto* object_this = [params, &state]() -> const foundation::boxed_value*
-			{
-				auto& scope = state.stack().recent_scope();
-				// changed since 0.5.4, see engine_stack::scope_type
-				// if (const auto it = scope.find(foundation::object_self_type_name::value);
-				// 	it != scope.end()) { return &it->second; }
-				// new code
-				if (const auto it = std::ranges::find(scope | std::views::keys, foundation::object_self_type_name::value);
-					it != std::ranges::end(scope | std::views::keys)) { return &it.base()->second; }
-
-				if (not params.empty()) { return &params.front(); }
-				return nullptr;
-			}();
+			// called by a trampoline, the tail call of this function is left to it
+			const bool is_tail_callee = state.stack().is_trampoline_location();
 
-			foundation::scoped_stack_scope scoped_stack{state};
-			if (object_this && not is_this_capture) { state->add_local_or_throw(foundation::object_self_name::value, *object_this); }
+			auto result = [&]() -> foundation::boxed_value
+			{
+				const auto* object_this = find_object_this(state, params);
 
-			std::ranges::for_each(
-					locals,
-					[&state](const auto& pair) { state->add_local_or_throw(pair.first, pair.second); });
+				foundation::scoped_stack_scope scoped_stack{state};
+				bind_function_locals(state, object_this, params, param_names, locals, is_this_capture);
 
-			utils::zip_invoke(
-					[&state](const auto& name, const auto& object) { if (name != foundation::object_self_name::value) { state->add_local_or_throw(name, object); } },
-					param_names,
-					params.begin());
+				try { return node.eval(state, visitor); }
+				catch (interrupt_type::interrupt_return& ret) { return std::move(ret.value); }
+			}();
 
-			try { return node.eval(state, visitor); }
-			catch (interrupt_type::interrupt_return& ret) { return std::move(ret.value); }
+			if (is_tail_callee || not state.stack().tail_call.has_value()) { return result; }
+			return eval_tail_calls(state);
 		}
 
 		[[nodiscard]] inline foundation::boxed_value clone_if_necessary(
@@ -79,12 +120,72 @@ namespace gal::lang
 				{
 					if (ti.bare_equal(typeid(bool))) { return foundation::boxed_value{*static_cast<const bool*>(incoming.get_const_raw())}; }
 					if (ti.bare_equal(typeid(types::string_type))) { return foundation::boxed_value{*static_cast<const types::string_type*>(incoming.get_const_raw())}; }
+					// the copy of a list/dict shares the elements until one of them is modified (see utils::copy_on_write)
+					if (ti.bare_equal(typeid(types::list_type))) { return foundation::boxed_value{*static_cast<const types::list_type*>(incoming.get_const_raw())}; }
+					if (ti.bare_equal(typeid(types::dict_type))) { return foundation::boxed_value{*static_cast<const types::dict_type*>(incoming.get_const_raw())}; }
 				}
 				return state->call_function(foundation::object_clone_interface_name::value, location, foundation::parameters_view_type{incoming});
 			}
 			incoming.to_lvalue();
 			return incoming;
 		}
+
+		class numeric_function;
+
+		/**
+		 * @brief Compile the body of a script function for the double arguments, or return null if the body is not supported (see numeric_function).
+		 */
+		[[nodiscard]] inline std::shared_ptr<const numeric_function> compile_numeric_function(const ast::ast_node& body, const std::vector<ast::ast_node::identifier_type>& param_names);
+
+		/**
+		 * @brief The numeric tier of a script function.
+		 * After compile_threshold calls with only double arguments, the body is compiled (once) into a numeric_function,
+		 * then the calls with only double arguments are made by it instead of evaluating the body, the other calls (and the bodies that cannot be compiled) are left to the interpreter.
+		 */
+		class numeric_tier
+		{
+		public:
+			using identifier_type = ast::ast_node::identifier_type;
+
+			constexpr static std::size_t compile_threshold = 16;
+
+			enum class state_type
+			{
+				// the calls are made by the interpreter, the body is not compiled yet
+				interpreted,
+				// the calls with only double arguments are made by the compiled function
+				compiled,
+				// the body cannot be compiled, the interpreter makes all the calls
+				unsupported,
+			};
+
+		private:
+			std::vector<identifier_type> param_names_;
+			// the function may be called by several threads, only the one that reaches the threshold compiles the body
+			std::atomic<std::size_t> calls_;
+			std::atomic<bool> failed_;
+			std::atomic<std::shared_ptr<const numeric_function>> function_;
+
+		public:
+			template<typename Range>
+				requires std::is_convertible_v<std::ranges::range_value_t<Range>, identifier_type>
+			explicit numeric_tier(const Range& param_names)
+				: calls_{0},
+				  failed_{false} { std::ranges::copy(param_names, std::back_inserter(param_names_)); }
+
+			[[nodiscard]] inline static bool is_numeric(foundation::parameters_view_type params) noexcept;
+
+			[[nodiscard]] state_type state() const noexcept
+			{
+				if (failed_.load(std::memory_order_acquire)) { return state_type::unsupported; }
+				return function_.load(std::memory_order_acquire) ? state_type::compiled : state_type::interpreted;
+			}
+
+			/**
+			 * @brief Make the call by the compiled function, or return nothing if the interpreter should make it.
+			 */
+			[[nodiscard]] inline std::optional<foundation::boxed_value> invoke(const ast::ast_node& body, foundation::parameters_view_type params);
+		};
 	}// namespace eval_detail
 
 	namespace ast
@@ -130,6 +231,31 @@ namespace gal::lang
 				: ast_node{get_rtti_index(), identifier, location} {}
 		};
 
+		struct last_use_id_ast_node final : ast_node
+		{
+		private:
+			mutable foundation::dispatcher::object_cache_location_type location_{};
+
+			[[nodiscard]] foundation::boxed_value do_eval(const foundation::dispatcher_state& state, ast_visitor_base&) override
+			{
+				try
+				{
+					auto object = state->get_object(this->identifier(), location_);
+					// the variable is never read again, the value is taken instead of cloned (see clone_if_necessary),
+					// unless it refers to an object owned by someone else (the variable and this copy are the only owners)
+					if (not object.is_reference() && object.use_count() == 2) { object.to_xvalue(); }
+					return object;
+				}
+				catch (std::exception&) { throw exception::eval_error{std_format::format("Can not find object '{}'", this->identifier())}; }
+			}
+
+		public:
+			GAL_AST_SET_RTTI(last_use_id_ast_node)
+
+			last_use_id_ast_node(const identifier_type identifier, const parse_location location)
+				: ast_node{get_rtti_index(), identifier, location} {}
+		};
+
 		struct constant_ast_node final : ast_node
 		{
 			foundation::boxed_value value;
@@ -216,9 +342,8 @@ namespace gal::lang
 
 					const foundation::scoped_function_scope scoped_function{state};
 
-					const foundation::parameters_view_type params{object};
-					state.stack().push_params(params);
-					state->call_function(this->identifier(), location_, params);
+					// the result is discarded, the argument does not have to be saved
+					state->call_function(this->identifier(), location_, foundation::parameters_view_type{object});
 				}
 				catch (const exception::dispatch_error& e)
 				{
@@ -277,8 +402,10 @@ namespace gal::lang
 
 					params_[0] = lhs;
 
-					state.stack().push_params(params_);
-					return state->call_function(operation, location_, params_);
+					auto result = state->call_function(operation, location_, params_);
+					// the right hand side is owned by the node
+					state.stack().save_params(std::span{params_}.first(1));
+					return result;
 				}
 				catch (const exception::dispatch_error& e)
 				{
@@ -304,61 +431,338 @@ namespace gal::lang
 				: ast_node{get_rtti_index(), operation, location, std::move(children)},
 				  operation_{foundation::algebraic_operation(operation)},
 				  params_{{{}, std::move(rhs)}} {}
+
+			[[nodiscard]] const foundation::boxed_value& rhs() const noexcept { return params_[1]; }
 		};
 
+		/**
+		 * @brief The node specializes itself for the types of the operands it sees (quickening).
+		 * After quicken_threshold evaluations with the same types, the arithmetic operation skips the type dispatch of the numbers,
+		 * and other operation calls the only overload that accepts the operands directly (instead of dispatching).
+		 * A type miss (or a change of the overload set) reverts the specialization, after max_despecialization reverts the node stays generic.
+		 */
 		struct binary_operator_ast_node final : ast_node
 		{
+			constexpr static std::size_t quicken_threshold = 8;
+			constexpr static std::size_t max_despecialization = 4;
+
+			enum class specialization_type
+			{
+				// profiling the types of the operands
+				none,
+				arithmetic,
+				function,
+				// the types change too often (or no overload can be called directly)
+				generic,
+			};
+
 		private:
+			using operands_type = std::array<foundation::boxed_value, 2>;
+
+			// the node may be evaluated by several threads, the specialization is only replaced as a whole
+			struct specialization_snapshot_type
+			{
+				specialization_type specialization{specialization_type::none};
+				foundation::gal_type_info lhs_type{};
+				foundation::gal_type_info rhs_type{};
+				std::size_t hits{0};
+				std::size_t despecializations{0};
+
+				// specialization_type::arithmetic
+				types::number_type::binary_invoker_type invoker{nullptr};
+				// specialization_type::function, the overload set is held to detect its change
+				std::shared_ptr<foundation::function_proxies_type> functions{};
+				const foundation::function_proxy_base* function{nullptr};
+
+				[[nodiscard]] bool is_specialized_for(const foundation::boxed_value& lhs, const foundation::boxed_value& rhs) const noexcept { return is_same_type(lhs.type_info(), lhs_type) && is_same_type(rhs.type_info(), rhs_type); }
+			};
+
 			foundation::algebraic_operations operation_;
 
 			mutable foundation::dispatcher::function_cache_location_type location_{};
 
+			mutable std::atomic<std::shared_ptr<const specialization_snapshot_type>> specialization_;
+
+			[[nodiscard]] static bool is_same_type(const foundation::gal_type_info& lhs, const foundation::gal_type_info& rhs) noexcept { return lhs.bare_equal(rhs) && lhs.is_const() == rhs.is_const(); }
+
+			// the overload can be called with the operands without any conversion (see function_handle_detail::is_directly_invokable)
+			[[nodiscard]] static bool is_directly_invokable(const foundation::function_proxy_base& function, const specialization_snapshot_type& specialization)
+			{
+				if (function.arity_size() != 2) { return false; }
+
+				const auto types = function.type_view();
+				const auto accepts = [](const foundation::gal_type_info& expected, const foundation::gal_type_info& type) { return expected.is_undefined() || expected.bare_equal(foundation::boxed_value::class_type()) || expected.bare_equal(type); };
+				return accepts(types[1], specialization.lhs_type) && accepts(types[2], specialization.rhs_type);
+			}
+
+			// the only overload that can be called with the operands directly, or null if it has to be dispatched
+			[[nodiscard]] static const foundation::function_proxy_base* resolve(const foundation::function_proxies_type& functions, const specialization_snapshot_type& specialization)
+			{
+				const foundation::function_proxy_base* candidate = nullptr;
+
+				for (const auto& function: functions)
+				{
+					// the guard may reject the operands, and the variadic function may accept anything
+					if (const auto* dynamic_function = dynamic_cast<const foundation::dynamic_function_proxy_base*>(function.get());
+						(dynamic_function && dynamic_function->has_guard()) || function->arity_size() == foundation::function_proxy_base::no_parameters_arity) { return nullptr; }
+
+					if (is_directly_invokable(*function, specialization))
+					{
+						// ambiguous, let the dispatcher decide
+						if (candidate) { return nullptr; }
+						candidate = function.get();
+					}
+				}
+
+				return candidate;
+			}
+
+			std::shared_ptr<const specialization_snapshot_type> despecialize(const specialization_snapshot_type& current) const
+			{
+				auto next = std::make_shared<specialization_snapshot_type>();
+				next->despecializations = current.despecializations + 1;
+				next->specialization = next->despecializations < max_despecialization ? specialization_type::none : specialization_type::generic;
+
+				specialization_.store(next, std::memory_order_release);
+				return next;
+			}
+
+			// record the types of the operands, the node is specialized if they do not change for a while
+			void profile(
+					const foundation::dispatcher_state& state,
+					const specialization_snapshot_type& current,
+					const foundation::boxed_value& lhs,
+					const foundation::boxed_value& rhs) const
+			{
+				auto next = std::make_shared<specialization_snapshot_type>(current);
+
+				if (not current.is_specialized_for(lhs, rhs))
+				{
+					next->lhs_type = lhs.type_info();
+					next->rhs_type = rhs.type_info();
+					next->hits = 1;
+				}
+				else if (++next->hits >= quicken_threshold)
+				{
+					if (operation_ != foundation::algebraic_operations::unknown && next->lhs_type.is_arithmetic() && next->rhs_type.is_arithmetic())
+					{
+						try
+						{
+							next->invoker = types::number_type::binary_invoker(lhs, rhs);
+							next->specialization = specialization_type::arithmetic;
+						}
+						catch (const std::bad_any_cast&) { next->specialization = specialization_type::generic; }
+					}
+					else
+					{
+						auto functions = state->get_function(this->identifier(), location_);
+						if (const auto* function = resolve(*functions, *next); function)
+						{
+							next->functions = std::move(functions);
+							next->function = function;
+							next->specialization = specialization_type::function;
+						}
+						else { next->specialization = specialization_type::generic; }
+					}
+				}
+
+				specialization_.store(std::move(next), std::memory_order_release);
+			}
+
+			foundation::boxed_value do_specialized_operation(
+					const foundation::dispatcher_state& state,
+					const specialization_snapshot_type& specialization,
+					operands_type& params) const
+			{
+				if (specialization.specialization == specialization_type::arithmetic)
+				{
+					try { return specialization.invoker(operation_, params[0], params[1]); }
+					catch (const exception::arithmetic_error&) { throw; }
+					catch (...) { throw exception::eval_error{std_format::format("Error with numeric operator '{}' called", this->identifier())}; }
+				}
+
+				{
+					const foundation::scoped_function_scope function_scope{state};
+
+					// the operands are checked before the call, the exceptions thrown by the body are passed up
+					if (auto result = specialization.function->try_invoke(foundation::parameters_view_type{params}, state.convertor_state()))
+					{
+						state.stack().save_params(params);
+						return std::move(*result);
+					}
+				}
+
+				// the overload rejects the operands after all, the dispatcher would try the others
+				(void)despecialize(specialization);
+				return do_operation(state, operation_, this->identifier(), params);
+			}
+
 			foundation::boxed_value do_operation(
 					const foundation::dispatcher_state& state,
 					const foundation::algebraic_operations operation,
 					const foundation::algebraic_operation_name_type operation_string,
-					const foundation::boxed_value& lhs,
-					const foundation::boxed_value& rhs) const
+					operands_type& params) const
 			{
 				try
 				{
-					if (operation != foundation::algebraic_operations::unknown && lhs.type_info().is_arithmetic() && rhs.type_info().is_arithmetic())
+					if (operation != foundation::algebraic_operations::unknown && params[0].type_info().is_arithmetic() && params[1].type_info().is_arithmetic())
 					{
 						// If it's an arithmetic operation we want to short circuit dispatch
-						try { return types::number_type::binary_invoke(operation, lhs, rhs); }
+						try { return types::number_type::binary_invoke(operation, params[0], params[1]); }
 						catch (const exception::arithmetic_error&) { throw; }
 						catch (...) { throw exception::eval_error{std_format::format("Error with numeric operator '{}' called", operation_string)}; }
 					}
 
 					const foundation::scoped_function_scope function_scope{state};
 
-					const std::array params{lhs, rhs};
-
-					state.stack().push_params(params);
-					return state->call_function(operation_string, location_, params);
+					auto result = state->call_function(operation_string, location_, params);
+					state.stack().save_params(params);
+					return result;
 				}
 				catch (const exception::dispatch_error& e) { throw exception::eval_error{std_format::format("Can not find appropriate '{}' operator", operation_string), e.parameters, e.functions, false, *state}; }
 			}
 
 			[[nodiscard]] foundation::boxed_value do_eval(const foundation::dispatcher_state& state, ast_visitor_base& visitor) override
 			{
+				operands_type params{
+						this->get_child(grammar::binary_operator_ast_node::lhs_index).eval(state, visitor),
+						this->get_child(grammar::binary_operator_ast_node::rhs_index).eval(state, visitor)};
+
+				// the snapshot holds the overload set, the node may be despecialized by the nested calls (or other threads)
+				auto specialization = specialization_.load(std::memory_order_acquire);
+
+				if (specialization->specialization == specialization_type::arithmetic || specialization->specialization == specialization_type::function)
+				{
+					if (specialization->is_specialized_for(params[0], params[1]) &&
+					    (specialization->specialization == specialization_type::arithmetic || state->get_function(this->identifier(), location_) == specialization->functions)) { return do_specialized_operation(state, *specialization, params); }
+
+					specialization = despecialize(*specialization);
+				}
+
+				if (specialization->specialization == specialization_type::none) { profile(state, *specialization, params[0], params[1]); }
+
 				return do_operation(
 						state,
 						operation_,
 						this->identifier(),
-						this->get_child(grammar::binary_operator_ast_node::lhs_index).eval(state, visitor),
-						this->get_child(grammar::binary_operator_ast_node::rhs_index).eval(state, visitor));
+						params);
 			}
 
 		public:
 			GAL_AST_SET_RTTI(binary_operator_ast_node)
 
+			[[nodiscard]] specialization_type specialization() const noexcept { return specialization_.load(std::memory_order_acquire)->specialization; }
+
 			binary_operator_ast_node(
 					const foundation::algebraic_operation_name_type operation,
 					const parse_location location,
 					children_type&& children)
 				: ast_node{get_rtti_index(), operation, location, std::move(children)},
-				  operation_{foundation::algebraic_operation(operation)} {}
+				  operation_{foundation::algebraic_operation(operation)},
+				  specialization_{std::make_shared<const specialization_snapshot_type>()} {}
+		};
+
+		struct string_interpolation_ast_node final : ast_node
+		{
+		private:
+			mutable foundation::dispatcher::function_cache_location_type location_{};
+
+			// the string form of a number part in the numbers buffer (begin, size)
+			using number_range_type = std::pair<foundation::string_type::size_type, foundation::string_type::size_type>;
+
+			/**
+			 * @brief Convert the part to its string form, numbers are written into the numbers buffer (the returned range), others will be converted via to_string.
+			 *
+			 * @return nothing if the (converted) part holds the string itself.
+			 */
+			[[nodiscard]] std::optional<number_range_type> convert_part(
+					const foundation::dispatcher_state& state,
+					foundation::boxed_value& part,
+					foundation::string_type& numbers) const
+			{
+				if (const auto& ti = part.type_info(); ti.is_arithmetic())
+				{
+					const auto begin = numbers.size();
+					types::number_type{part}.append_to(numbers);
+					return number_range_type{begin, numbers.size() - begin};
+				}
+
+				if (const auto& ti = part.type_info(); not ti.bare_equal(typeid(types::string_type)) && not ti.bare_equal(typeid(types::string_view_type)))
+				{
+					try
+					{
+						const foundation::scoped_function_scope function_scope{state};
+
+						auto result = state->call_function(foundation::operator_to_string_name::value, location_, foundation::parameters_view_type{part});
+						state.stack().save_params(std::span{&part, 1});
+						part = std::move(result);
+					}
+					catch (const exception::dispatch_error& e)
+					{
+						throw exception::eval_error{
+								std_format::format("Can not find appropriate '{}' function for string interpolation", foundation::operator_to_string_name::value),
+								e.parameters,
+								e.functions,
+								false,
+								*state};
+					}
+				}
+
+				if (const auto& ti = part.type_info(); ti.bare_equal(typeid(types::string_type)) || ti.bare_equal(typeid(types::string_view_type))) { return std::nullopt; }
+
+				throw exception::eval_error{std_format::format("'{}' should return a string in string interpolation", foundation::operator_to_string_name::value)};
+			}
+
+			/**
+			 * @brief The string held by the converted part.
+			 */
+			[[nodiscard]] static foundation::string_view_type part_string(const foundation::boxed_value& part) noexcept
+			{
+				if (part.type_info().bare_equal(typeid(types::string_type))) { return static_cast<const types::string_type*>(part.get_const_raw())->data(); }
+				return static_cast<const types::string_view_type*>(part.get_const_raw())->data();
+			}
+
+			[[nodiscard]] foundation::boxed_value do_eval(const foundation::dispatcher_state& state, ast_visitor_base& visitor) override
+			{
+				// evaluate all parts first, the later parts may modify the strings of the earlier parts
+				foundation::parameters_type parts;
+				parts.reserve(this->size());
+				std::ranges::for_each(this->view(), [&parts, &state, &visitor](auto& child) { parts.emplace_back(child.eval(state, visitor)); });
+
+				// then convert them (to_string may modify them as well)
+				std::vector<std::optional<number_range_type>> number_ranges;
+				number_ranges.reserve(parts.size());
+				foundation::string_type numbers;
+				std::ranges::for_each(parts, [this, &number_ranges, &numbers, &state](auto& part) { number_ranges.push_back(convert_part(state, part, numbers)); });
+
+				// nothing is evaluated from now on, the views are stable
+				std::vector<foundation::string_view_type> views;
+				views.reserve(parts.size());
+				std::size_t total_size = 0;
+				utils::zip_invoke(
+						[&views, &numbers, &total_size](const auto& part, const auto& range)
+						{
+							const auto view = range.has_value() ? foundation::string_view_type{numbers}.substr(range->first, range->second) : part_string(part);
+							total_size += views.emplace_back(view).size();
+						},
+						parts,
+						number_ranges.begin());
+
+				types::string_type::container_type result;
+				result.reserve(total_size);
+				std::ranges::for_each(views, [&result](const auto view) { result.append(view); });
+
+				return foundation::boxed_value{types::string_type{std::move(result)}};
+			}
+
+		public:
+			GAL_AST_SET_RTTI(string_interpolation_ast_node)
+
+			string_interpolation_ast_node(
+					const identifier_type identifier,
+					const parse_location location,
+					children_type&& children)
+				: ast_node{get_rtti_index(), identifier, location, std::move(children)} {}
 		};
 
 		struct fun_call_ast_node final : ast_node
@@ -378,11 +782,33 @@ namespace gal::lang
 						node.get_child(grammar::fun_call_ast_node::arg_list_index).view(),
 						[&params, &state, &visitor](auto& child) { params.push_back(child.eval(state, visitor)); });
 
-				if constexpr (SaveParams) { state.stack().push_params(params); }
-				else { }
-
 				const foundation::boxed_value function{node.get_child(grammar::fun_call_ast_node::function_index).eval(state, visitor)};
 
+				auto result = call_function(node.get_child(grammar::fun_call_ast_node::function_index), function, params, state);
+				if constexpr (SaveParams) { state.stack().save_params(params); }
+				return result;
+			}
+
+			[[nodiscard]] foundation::boxed_value do_eval(const foundation::dispatcher_state& state, ast_visitor_base& visitor) override { return do_eval<true>(*this, state, visitor); }
+
+		public:
+			GAL_AST_SET_RTTI(fun_call_ast_node)
+
+			fun_call_ast_node(
+					const identifier_type identifier,
+					const parse_location location,
+					children_type&& children)
+				: ast_node{get_rtti_index(), identifier, location, std::move(children)} { gal_assert(not this->empty()); }
+
+			/**
+			 * @brief Call the (evaluated) function with the (evaluated) params, the errors are reported with the function node.
+			 */
+			[[nodiscard]] static foundation::boxed_value call_function(
+					const ast_node& function_node,
+					const foundation::boxed_value& function,
+					const foundation::parameters_type& params,
+					const foundation::dispatcher_state& state)
+			{
 				try
 				{
 					const foundation::convertor_manager_state convertor_manager_state{state->get_conversion_manager()};
@@ -394,7 +820,7 @@ namespace gal::lang
 							std_format::format(
 									"dispatch_error '{}' with function '{}' called.",
 									e.what(),
-									node.get_child(grammar::fun_call_ast_node::function_index).identifier()),
+									function_node.identifier()),
 							e.parameters,
 							e.functions,
 							false,
@@ -409,7 +835,7 @@ namespace gal::lang
 								std_format::format(
 										"bad_boxed_cast '{}' with function '{}' called.",
 										e.what(),
-										node.get_child(grammar::fun_call_ast_node::function_index).identifier()),
+										function_node.identifier()),
 								params,
 								foundation::const_function_proxies_view_type{state->boxed_cast<const foundation::const_function_proxy_type&>(function)},
 								false,
@@ -421,33 +847,22 @@ namespace gal::lang
 								std_format::format(
 										"bad_boxed_cast '{}', '{}' does not evaluate to a function.",
 										ie.what(),
-										node.get_child(grammar::fun_call_ast_node::function_index).pretty_print())
+										function_node.pretty_print())
 						};
 					}
 				}
 				catch (const exception::arity_error& e)
 				{
 					throw exception::eval_error{
-							std_format::format("arity_error '{}' with function '{}' called.", e.what(), node.get_child(grammar::fun_call_ast_node::function_index).identifier())};
+							std_format::format("arity_error '{}' with function '{}' called.", e.what(), function_node.identifier())};
 				}
 				catch (const exception::guard_error& e)
 				{
 					throw exception::eval_error{
-							std_format::format("guard_error '{}' with function '{}' called.", e.what(), node.get_child(grammar::fun_call_ast_node::function_index).identifier())};
+							std_format::format("guard_error '{}' with function '{}' called.", e.what(), function_node.identifier())};
 				}
 				catch (interrupt_type::interrupt_return& ret) { return std::move(ret.value); }
 			}
-
-			[[nodiscard]] foundation::boxed_value do_eval(const foundation::dispatcher_state& state, ast_visitor_base& visitor) override { return do_eval<true>(*this, state, visitor); }
-
-		public:
-			GAL_AST_SET_RTTI(fun_call_ast_node)
-
-			fun_call_ast_node(
-					const identifier_type identifier,
-					const parse_location location,
-					children_type&& children)
-				: ast_node{get_rtti_index(), identifier, location, std::move(children)} { gal_assert(not this->empty()); }
 		};
 
 		struct unused_return_fun_call_ast_node final : ast_node
@@ -465,50 +880,152 @@ namespace gal::lang
 				: ast_node{get_rtti_index(), identifier, location, std::move(children)} { gal_assert(not this->empty()); }
 		};
 
-		struct array_access_ast_node final : ast_node
+		struct tail_call_ast_node final : ast_node
 		{
 		private:
-			mutable foundation::dispatcher::function_cache_location_type location_{};
-
 			[[nodiscard]] foundation::boxed_value do_eval(const foundation::dispatcher_state& state, ast_visitor_base& visitor) override
 			{
-				const foundation::scoped_function_scope scoped_function{state};
+				foundation::parameters_type params;
+				params.reserve(this->get_child(grammar::tail_call_ast_node::arg_list_index).size());
 
-				const std::array params{
-						this->get_child(grammar::array_access_ast_node::operation_target_index).eval(state, visitor),
-						this->get_child(grammar::array_access_ast_node::operation_parameter_index).eval(state, visitor)};
+				std::ranges::for_each(
+						this->get_child(grammar::tail_call_ast_node::arg_list_index).view(),
+						[&params, &state, &visitor](auto& child) { params.push_back(child.eval(state, visitor)); });
 
-				try
-				{
-					state.stack().push_params(params);
-					return state->call_function(foundation::container_subscript_interface_name::value, location_, params);
-				}
-				catch (const exception::dispatch_error& e) { throw exception::eval_error{std_format::format("Can not find appropriate array lookup operator '{}'", foundation::container_subscript_interface_name::value), e.parameters, e.functions, false, *state}; }
+				foundation::boxed_value function{this->get_child(grammar::tail_call_ast_node::function_index).eval(state, visitor)};
+
+				// the call is made after the current function returns (see eval_detail::eval_function)
+				gal_assert(not state.stack().tail_call.has_value());
+				state.stack().tail_call.emplace(std::move(function), std::move(params), &this->get_child(grammar::tail_call_ast_node::function_index));
+
+				return void_var();
 			}
 
 		public:
-			GAL_AST_SET_RTTI(array_access_ast_node)
+			GAL_AST_SET_RTTI(tail_call_ast_node)
 
-			array_access_ast_node(
+			tail_call_ast_node(
 					const identifier_type identifier,
 					const parse_location location,
 					children_type&& children)
-				: ast_node{get_rtti_index(), identifier, location, std::move(children)} {}
+				: ast_node{get_rtti_index(), identifier, location, std::move(children)} { gal_assert(not this->empty()); }
 		};
 
-		struct dot_access_ast_node final : ast_node
+		struct inline_call_ast_node final : ast_node
 		{
+			using shared_node_type = std::shared_ptr<ast_node>;
+			using param_names_type = std::vector<identifier_type>;
+
 		private:
-			foundation::string_view_type function_name_;
+			shared_node_type body_;
+			param_names_type param_names_;
 
-			mutable foundation::dispatcher::function_cache_location_type location_{};
-			mutable foundation::dispatcher::function_cache_location_type array_location_{};
+			[[nodiscard]] bool is_inlined_function(const foundation::boxed_value& function, const foundation::dispatcher_state& state) const
+			{
+				const foundation::function_proxy_base* proxy;
+				// not a function, the call reports it
+				try { proxy = state->boxed_cast<const foundation::function_proxy_base*>(function); }
+				catch (const exception::bad_boxed_cast&) { return false; }
+
+				// the name is shadowed or the overload set changed, call it as usual
+				const auto* dynamic_function = dynamic_cast<const foundation::dynamic_function_proxy_base*>(proxy);
+				return dynamic_function &&
+				       not dynamic_function->has_guard() &&
+				       dynamic_function->has_function_body() &&
+				       &dynamic_function->get_function_body() == body_.get() &&
+				       dynamic_function->arity_size() == static_cast<foundation::function_proxy_base::arity_size_type>(param_names_.size());
+			}
 
 			[[nodiscard]] foundation::boxed_value do_eval(const foundation::dispatcher_state& state, ast_visitor_base& visitor) override
 			{
-				const foundation::scoped_function_scope scoped_function{state};
+				const foundation::scoped_function_scope function_scope{state};
 
-				auto ret{this->get_child(grammar::dot_access_ast_node::target_index).eval(state, visitor)};
+				foundation::parameters_type params;
+				params.reserve(this->get_child(grammar::inline_call_ast_node::arg_list_index).size());
+
+				std::ranges::for_each(
+						this->get_child(grammar::inline_call_ast_node::arg_list_index).view(),
+						[&params, &state, &visitor](auto& child) { params.push_back(child.eval(state, visitor)); });
+
+				const foundation::boxed_value function{this->get_child(grammar::inline_call_ast_node::function_index).eval(state, visitor)};
+
+				if (is_inlined_function(function, state))
+				{
+					// the body only refers to its parameters and its own locals (see inline_optimizer), bind them
+					// in a new scope of the caller's stack instead of pushing a new stack, the slots are the same as eval_function's
+					const auto* object_this = find_object_this(state, foundation::parameters_view_type{params});
+
+					foundation::scoped_scope scope{state};
+					bind_function_locals(state, object_this, foundation::parameters_view_type{params}, param_names_);
+
+					try { return body_->eval(state, visitor); }
+					catch (interrupt_type::interrupt_return& ret) { return std::move(ret.value); }
+				}
+
+				auto result = fun_call_ast_node::call_function(this->get_child(grammar::inline_call_ast_node::function_index), function, params, state);
+				state.stack().save_params(params);
+				return result;
+			}
+
+		public:
+			GAL_AST_SET_RTTI(inline_call_ast_node)
+
+			inline_call_ast_node(
+					const identifier_type identifier,
+					const parse_location location,
+					children_type&& children,
+					shared_node_type body,
+					param_names_type param_names)
+				: ast_node{get_rtti_index(), identifier, location, std::move(children)},
+				  body_{std::move(body)},
+				  param_names_{std::move(param_names)} { gal_assert(not this->empty()); }
+		};
+
+		struct array_access_ast_node final : ast_node
+		{
+		private:
+			mutable foundation::dispatcher::function_cache_location_type location_{};
+
+			[[nodiscard]] foundation::boxed_value do_eval(const foundation::dispatcher_state& state, ast_visitor_base& visitor) override
+			{
+				const foundation::scoped_function_scope scoped_function{state};
+
+				std::array params{
+						this->get_child(grammar::array_access_ast_node::operation_target_index).eval(state, visitor),
+						this->get_child(grammar::array_access_ast_node::operation_parameter_index).eval(state, visitor)};
+
+				try
+				{
+					auto result = state->call_function(foundation::container_subscript_interface_name::value, location_, params);
+					state.stack().save_params(params);
+					return result;
+				}
+				catch (const exception::dispatch_error& e) { throw exception::eval_error{std_format::format("Can not find appropriate array lookup operator '{}'", foundation::container_subscript_interface_name::value), e.parameters, e.functions, false, *state}; }
+			}
+
+		public:
+			GAL_AST_SET_RTTI(array_access_ast_node)
+
+			array_access_ast_node(
+					const identifier_type identifier,
+					const parse_location location,
+					children_type&& children)
+				: ast_node{get_rtti_index(), identifier, location, std::move(children)} {}
+		};
+
+		struct dot_access_ast_node final : ast_node
+		{
+		private:
+			foundation::string_view_type function_name_;
+
+			mutable foundation::dispatcher::function_cache_location_type location_{};
+			mutable foundation::dispatcher::function_cache_location_type array_location_{};
+
+			[[nodiscard]] foundation::boxed_value do_eval(const foundation::dispatcher_state& state, ast_visitor_base& visitor) override
+			{
+				const foundation::scoped_function_scope scoped_function{state};
+
+				auto ret{this->get_child(grammar::dot_access_ast_node::target_index).eval(state, visitor)};
 				foundation::parameters_type params{ret};
 
 				const bool has_function_params = [this, &params, &state, &visitor]
@@ -524,26 +1041,27 @@ namespace gal::lang
 					return false;
 				}();
 
-				const foundation::parameters_view_type ps{params};
-				state.stack().push_params(ps);
-				try { ret = state->call_member_function(function_name_, location_, ps, has_function_params); }
+				try { ret = state->call_member_function(function_name_, location_, foundation::parameters_view_type{params}, has_function_params); }
 				catch (const exception::dispatch_error& e)
 				{
 					if (e.functions.empty()) { throw exception::eval_error{std_format::format("'{}' is not a function", function_name_)}; }
 					throw exception::eval_error{std_format::format("{} for function '{}' called", e.what(), function_name_), e.parameters, e.functions, true, *state};
 				}
 				catch (interrupt_type::interrupt_return& r) { ret = std::move(r.value); }
+				state.stack().save_params(params);
 
 				if (auto& c = this->get_child(grammar::dot_access_ast_node::function_index);
 					c.is<array_access_ast_node>())
 				{
 					try
 					{
-						const foundation::parameters_type p{
+						foundation::parameters_type p{
 								ret,
 								c.get_child(grammar::array_access_ast_node::operation_parameter_index).eval(state, visitor)
 						};
 						ret = state->call_function(foundation::container_subscript_interface_name::value, array_location_, p);
+						// the container may be a temporary (the result of the call), the element refers to it
+						state.stack().save_params(p);
 					}
 					catch (const exception::dispatch_error& e) { throw exception::eval_error{std_format::format("Can not find appropriate array lookup operator '{}'", foundation::container_subscript_interface_name::value), e.parameters, e.functions, false, *state}; }
 				}
@@ -871,6 +1389,11 @@ namespace gal::lang
 			shared_node_type body_node;
 			shared_node_type guard_node;
 
+		private:
+			// the numeric tier of the function defined by the last evaluation
+			std::shared_ptr<eval_detail::numeric_tier> tier_;
+
+		public:
 			[[nodiscard]] static shared_node_type get_body_node(children_type&& children)
 			{
 				// is not accessed from index, because we know body_node is always at the end
@@ -953,14 +1476,18 @@ namespace gal::lang
 					return foundation::function_proxy_type{};
 				}();
 
+				tier_ = std::make_shared<eval_detail::numeric_tier>(param_names);
+
 				try
 				{
 					const auto& name = this->get_child(grammar::def_ast_node::function_name_index).identifier();
 					state->add_function(
 							name,
 							make_dynamic_function_proxy(
-									[this, dispatcher, param_names, &visitor](const foundation::parameters_view_type params)
+									[this, dispatcher, param_names, tier = tier_, &visitor](const foundation::parameters_view_type params)
 									{
+										if (auto result = tier->invoke(*body_node, params)) { return *std::move(result); }
+
 										return eval_detail::eval_function(
 												dispatcher,
 												*body_node,
@@ -981,6 +1508,11 @@ namespace gal::lang
 		public:
 			GAL_AST_SET_RTTI(def_ast_node)
 
+			/**
+			 * @brief The numeric tier of the function defined by the last evaluation of the node, or null if it is not evaluated yet.
+			 */
+			[[nodiscard]] const eval_detail::numeric_tier* tier() const noexcept { return tier_.get(); }
+
 			def_ast_node(
 					const identifier_type identifier,
 					const parse_location location,
@@ -1153,6 +1685,8 @@ namespace gal::lang
 		public:
 			GAL_AST_SET_RTTI(lambda_ast_node)
 
+			[[nodiscard]] shared_node_type& body_node() noexcept { return lambda_node_; }
+
 			lambda_ast_node(
 					const identifier_type identifier,
 					const parse_location location,
@@ -1236,12 +1770,332 @@ namespace gal::lang
 				: ast_node{get_rtti_index(), identifier, location, std::move(children)} { gal_assert(this->size() == 3); }
 		};
 
+		/**
+		 * @brief The invariant expressions of a loop (see ast_optimizer.hpp => loop_invariant_optimizer) and what the loop requires to cache their values.
+		 * The values are kept in a hidden local variable of the loop scope, they are computed (at most) once each time the loop is entered.
+		 *
+		 * @note Whether the values can be cached is checked each time the loop is entered: the loop must not call any script function (or pass a function to a native one that may call it back),
+		 * the calls of the invariant expressions must be pure, and the variables they read must not be modified in the loop (or share anything with the modified variables).
+		 * The native functions are assumed to modify nothing but their arguments, and the reading operators (see foundation::algebraic_operations) nothing at all.
+		 */
+		class loop_invariant_scope
+		{
+		public:
+			using identifier_type = ast_node::identifier_type;
+			using identifiers_type = std::vector<identifier_type>;
+			using values_type = std::vector<foundation::boxed_value>;
+
+			// the names of the hidden local variable, the nested loops use different names
+			constexpr static std::array<foundation::string_view_type, 8> names{
+					"$loop_invariants_0",
+					"$loop_invariants_1",
+					"$loop_invariants_2",
+					"$loop_invariants_3",
+					"$loop_invariants_4",
+					"$loop_invariants_5",
+					"$loop_invariants_6",
+					"$loop_invariants_7"};
+
+			struct call_type
+			{
+				identifier_type name;
+				// the variable passed as each argument, or empty if the argument is not a variable
+				identifiers_type arguments;
+				// the variables whose objects the call may modify (if it is not pure)
+				identifiers_type operands;
+				// it is called by name, a variable of the same name would be called instead of the function
+				bool by_name;
+				// the arity is not checked, only the first argument is (see dispatcher::call_member_function => method_missing)
+				bool any_arity;
+				// it is a part of an invariant expression, it must be pure
+				bool cached;
+			};
+
+			struct alias_type
+			{
+				identifier_type name;
+				// the variables whose objects may be (partly) referred by the variable
+				identifiers_type targets;
+			};
+
+		private:
+			// what the overload sets tell about the calls, it only changes when the functions change
+			struct overloads_type
+			{
+				struct call_overloads_type
+				{
+					std::shared_ptr<foundation::function_proxies_type> functions;
+					// one of the overloads is a script function, it may modify anything
+					bool script;
+					// none of the overloads calls a script function (see foundation::function_attribute::no_script_callback)
+					bool callback_free;
+					// every overload is pure, the arguments need not be checked
+					bool pure;
+				};
+
+				// see dispatcher::functions_generation
+				std::size_t generation;
+				// the same order as the calls
+				std::vector<call_overloads_type> calls;
+				// whether each of the variables referred in the loop names a function (if no object hides it)
+				std::vector<bool> function_names;
+			};
+
+			std::size_t name_index_;
+			values_type::size_type size_;
+			std::vector<call_type> calls_;
+			// the variables declared or assigned in the loop
+			identifiers_type modified_;
+			std::vector<alias_type> aliases_;
+			// the variables read by the invariant expressions
+			identifiers_type reads_;
+			// all the variables referred in the loop
+			identifiers_type variables_;
+
+			mutable std::atomic<std::shared_ptr<const overloads_type>> overloads_{};
+
+			[[nodiscard]] static bool is_function_object(const foundation::boxed_value& object) noexcept
+			{
+				return object.type_info().bare_equal(foundation::make_type_info<foundation::function_proxy_type>()) ||
+				       object.type_info().bare_equal(foundation::make_type_info<foundation::const_function_proxy_type>());
+			}
+
+			// the object is only referred by its variable (and the copy we got), nothing else can see its changes
+			[[nodiscard]] static bool is_unshared(const foundation::boxed_value& object) noexcept { return object.use_count() <= 2; }
+
+			// arithmetic, boolean and string values cannot contain other objects
+			[[nodiscard]] static bool is_leaf(const foundation::boxed_value& object) noexcept
+			{
+				const auto& type = object.type_info();
+				return type.is_arithmetic() || type.bare_equal(typeid(bool)) || type.bare_equal(types::string_type::class_type());
+			}
+
+			void add_modified(identifiers_type& modified, const identifier_type name) const
+			{
+				if (std::ranges::find(modified, name) != modified.end()) { return; }
+				modified.push_back(name);
+
+				for (const auto& alias: aliases_) { if (alias.name == name) { for (const auto target: alias.targets) { add_modified(modified, target); } } }
+			}
+
+			[[nodiscard]] std::shared_ptr<const overloads_type> get_overloads(const foundation::dispatcher_state& state) const
+			{
+				// read the generation first, the functions changed during the lookups are looked up again next time
+				const auto generation = state->functions_generation();
+				if (auto overloads = overloads_.load(std::memory_order_acquire);
+					overloads && overloads->generation == generation) { return overloads; }
+
+				auto overloads = std::make_shared<overloads_type>();
+				overloads->generation = generation;
+
+				overloads->calls.reserve(calls_.size());
+				for (const auto& call: calls_)
+				{
+					auto functions = state->get_function(call.name);
+					const auto all_have = [&functions](const foundation::function_attribute attribute) { return std::ranges::all_of(*functions, [attribute](const auto& function) { return function->has_attribute(attribute); }); };
+
+					overloads->calls.push_back({
+							.functions = functions,
+							.script = std::ranges::any_of(*functions, [](const auto& function) { return dynamic_cast<const foundation::dynamic_function_proxy_base*>(function.get()) != nullptr; }),
+							.callback_free = all_have(foundation::function_attribute::no_script_callback),
+							.pure = all_have(foundation::function_attribute::pure)});
+				}
+
+				overloads->function_names.reserve(variables_.size());
+				for (const auto name: variables_) { overloads->function_names.push_back(not state->get_function(name)->empty()); }
+
+				overloads_.store(overloads, std::memory_order_release);
+				return overloads;
+			}
+
+			/**
+			 * @brief Whether all the overloads that may be called are pure, the overloads that cannot accept the current value of the (unmodified) arguments are skipped.
+			 */
+			[[nodiscard]] static bool is_pure(const call_type& call, const overloads_type::call_overloads_type& overloads, const identifiers_type& modified, const foundation::dispatcher_state& state)
+			{
+				if (overloads.pure) { return true; }
+
+				const auto may_accept = [&](const foundation::function_proxy_base& function, const identifiers_type::size_type index)
+				{
+					const auto argument = call.arguments[index];
+					if (argument.empty() || std::ranges::find(modified, argument) != modified.end()) { return true; }
+
+					const auto object = state->find_object(argument);
+					return not object.has_value() || foundation::function_proxy_base::is_convertible(function.type_view()[index + 1], *object, state.convertor_state());
+				};
+
+				return std::ranges::all_of(
+						*overloads.functions,
+						[&](const auto& function)
+						{
+							if (const auto arity = function->arity_size();
+								arity != foundation::function_proxy_base::no_parameters_arity)
+							{
+								if (call.any_arity)
+								{
+									if (arity != 0 && not call.arguments.empty() && not may_accept(*function, 0)) { return true; }
+								}
+								else
+								{
+									if (static_cast<identifiers_type::size_type>(arity) != call.arguments.size()) { return true; }
+									for (identifiers_type::size_type i = 0; i < call.arguments.size(); ++i) { if (not may_accept(*function, i)) { return true; } }
+								}
+							}
+
+							return function->has_attribute(foundation::function_attribute::pure);
+						});
+			}
+
+			[[nodiscard]] bool cacheable(const foundation::dispatcher_state& state) const
+			{
+				const auto overloads = get_overloads(state);
+
+				for (decltype(calls_.size()) i = 0; i < calls_.size(); ++i)
+				{
+					// the script functions (and the variables called as functions) may modify anything
+					if (overloads->calls[i].script) { return false; }
+					if (calls_[i].by_name && state->find_object(calls_[i].name).has_value()) { return false; }
+				}
+
+				// the native function may call the function passed to it, unless it is known not to
+				for (decltype(variables_.size()) i = 0; i < variables_.size(); ++i)
+				{
+					const auto name = variables_[i];
+					if (const auto object = state->find_object(name))
+					{
+						if (not is_function_object(*object)) { continue; }
+					}
+					else if (not overloads->function_names[i]) { continue; }
+
+					bool passed = false;
+					for (decltype(calls_.size()) j = 0; j < calls_.size(); ++j)
+					{
+						if (std::ranges::find(calls_[j].arguments, name) == calls_[j].arguments.end()) { continue; }
+						if (not overloads->calls[j].callback_free) { return false; }
+						passed = true;
+					}
+					if (not passed) { return false; }
+				}
+
+				identifiers_type modified{};
+				for (const auto name: modified_) { add_modified(modified, name); }
+
+				// a call that is not pure may modify its operands, and the calls that take them may no longer be known as pure
+				std::vector<bool> impure(calls_.size(), false);
+				bool has_impure = false;
+				for (bool changed = true; changed;)
+				{
+					changed = false;
+					for (decltype(calls_.size()) i = 0; i < calls_.size(); ++i)
+					{
+						if (impure[i] || is_pure(calls_[i], overloads->calls[i], modified, state)) { continue; }
+						// it may call a script function, which may modify anything
+						if (calls_[i].cached || not overloads->calls[i].callback_free) { return false; }
+
+						for (const auto operand: calls_[i].operands) { add_modified(modified, operand); }
+
+						impure[i] = true;
+						has_impure = true;
+						changed = true;
+					}
+				}
+
+				if (std::ranges::any_of(reads_, [&modified](const auto name) { return std::ranges::find(modified, name) != modified.end(); })) { return false; }
+
+				// the native function may modify the global objects (such as the ones shared with the host) besides its operands
+				if (has_impure && not std::ranges::all_of(reads_, [&state](const auto name) { return state->find_local(name).has_value(); })) { return false; }
+
+				bool modify_container = false;
+				for (const auto name: modified)
+				{
+					if (const auto object = state->find_object(name))
+					{
+						// the object may be a part of the variables read
+						if (not is_unshared(*object)) { return false; }
+						modify_container |= not is_leaf(*object);
+					}
+				}
+
+				// the variables read may be a part of the modified objects
+				if (modify_container) { return std::ranges::all_of(reads_, [&state](const auto name) { const auto object = state->find_object(name); return not object.has_value() || is_unshared(*object); }); }
+
+				return true;
+			}
+
+		public:
+			loop_invariant_scope(
+					const std::size_t name_index,
+					const values_type::size_type size,
+					std::vector<call_type>&& calls,
+					identifiers_type&& modified,
+					std::vector<alias_type>&& aliases,
+					identifiers_type&& reads,
+					const identifiers_type& variables)
+				: name_index_{name_index},
+				  size_{size},
+				  calls_{std::move(calls)},
+				  modified_{std::move(modified)},
+				  aliases_{std::move(aliases)},
+				  reads_{std::move(reads)},
+				  variables_{variables} { gal_assert(name_index_ < names.size()); }
+
+			[[nodiscard]] constexpr std::size_t name_index() const noexcept { return name_index_; }
+
+			[[nodiscard]] constexpr foundation::string_view_type name() const noexcept { return names[name_index_]; }
+
+			/**
+			 * @brief Add the hidden local variable to the loop scope, it holds no values if they cannot be cached this time.
+			 */
+			void enter(const foundation::dispatcher_state& state) const { state->add_local_or_throw(name(), cacheable(state) ? foundation::boxed_value{values_type(size_)} : foundation::boxed_value{}); }
+		};
+
+		struct loop_invariant_ast_node final : ast_node
+		{
+		private:
+			foundation::string_view_type name_;
+			loop_invariant_scope::values_type::size_type index_;
+
+			mutable foundation::dispatcher::object_cache_location_type location_{};
+
+			[[nodiscard]] foundation::boxed_value do_eval(const foundation::dispatcher_state& state, ast_visitor_base& visitor) override
+			{
+				auto& expression = this->get_child(grammar::loop_invariant_ast_node::expression_index);
+
+				const auto& values = state->get_object(name_, location_);
+				// the loop cannot cache the values this time
+				if (values.is_undefined()) { return expression.eval(state, visitor); }
+
+				auto& value = (*static_cast<loop_invariant_scope::values_type*>(values.get_raw()))[index_];
+				if (value.is_undefined()) { value = expression.eval(state, visitor); }
+				return value;
+			}
+
+			loop_invariant_ast_node(
+					ast_node_common_base&& base,
+					ast_node_ptr&& expression,
+					const foundation::string_view_type name,
+					const loop_invariant_scope::values_type::size_type index)
+				: ast_node{std::move(base)},
+				  name_{name},
+				  index_{index} { children_.push_back(std::move(expression)); }
+
+		public:
+			GAL_AST_SET_RTTI(loop_invariant_ast_node)
+
+			loop_invariant_ast_node(
+					ast_node_ptr&& expression,
+					const foundation::string_view_type name,
+					const loop_invariant_scope::values_type::size_type index)
+				: loop_invariant_ast_node{ast_node_common_base{get_rtti_index(), *expression}, std::move(expression), name, index} {}
+		};
+
 		struct while_ast_node final : ast_node
 		{
 		private:
 			[[nodiscard]] foundation::boxed_value do_eval(const foundation::dispatcher_state& state, ast_visitor_base& visitor) override
 			{
 				foundation::scoped_scope scoped_scope{state};
+				if (invariants) { invariants->enter(state); }
 
 				try
 				{
@@ -1267,6 +2121,9 @@ namespace gal::lang
 		public:
 			GAL_AST_SET_RTTI(while_ast_node)
 
+			// set by the optimizer if the loop has any invariant expression
+			std::unique_ptr<loop_invariant_scope> invariants;
+
 			while_ast_node(
 					const identifier_type identifier,
 					const parse_location location,
@@ -1274,88 +2131,211 @@ namespace gal::lang
 				: ast_node{get_rtti_index(), identifier, location, std::move(children)} {}
 		};
 
+		struct counted_for_ast_node;
+
 		struct ranged_for_ast_node final : ast_node
 		{
+			friend struct counted_for_ast_node;
+
 		private:
 			using location_type = foundation::dispatcher::function_cache_location_type;
 
-			mutable location_type view_location_{};
-			mutable location_type empty_location_{};
-			mutable location_type star_location_{};
-			mutable location_type advance_location_{};
+			struct view_function_locations
+			{
+				location_type view{};
+				location_type empty{};
+				location_type star{};
+				location_type advance{};
+			};
+
+			mutable view_function_locations locations_{};
+
+			/**
+			 * @brief The slot of the loop variable, the body may add locals to its scope (which moves the objects), so the slot is fetched again in each iteration.
+			 */
+			class loop_variable_slot
+			{
+			public:
+				using stack_type = foundation::engine_stack::stack_type;
+				using scope_type = foundation::engine_stack::scope_type;
+
+			private:
+				foundation::engine_stack& stack_;
+				stack_type::size_type scope_;
+				scope_type::size_type index_;
+
+			public:
+				loop_variable_slot(const foundation::dispatcher_state& state, const foundation::string_view_type name, foundation::boxed_value object)
+					: stack_{state.stack()},
+					  scope_{stack_.recent_stack().size() - 1},
+					  index_{stack_.recent_scope().size()} { state->add_local_or_throw(name, std::move(object)); }
+
+				[[nodiscard]] foundation::boxed_value& get() const noexcept { return stack_.recent_stack()[scope_][index_].second; }
+			};
+
+			/**
+			 * @brief Evaluate the body once, return false if the loop is broken.
+			 */
+			[[nodiscard]] static bool eval_body(ast_node& body, const foundation::dispatcher_state& state, ast_visitor_base& visitor)
+			{
+				try { body.eval(state, visitor); }
+				catch (const interrupt_type::interrupt_continue&) { }
+				catch (const interrupt_type::interrupt_break&)
+				{
+					// loop broken
+					return false;
+				}
+
+				return true;
+			}
 
-			[[nodiscard]] foundation::boxed_value do_eval(const foundation::dispatcher_state& state, ast_visitor_base& visitor) override
+			/**
+			 * @brief Drive the view of a builtin container directly, no dispatch required.
+			 */
+			template<typename View>
+			static void eval_view(View view, ast_node& body, const loop_variable_slot& loop_variable, const foundation::dispatcher_state& state, ast_visitor_base& visitor)
+			{
+				for (; not view.empty(); view.advance())
+				{
+					loop_variable.get() = view.get();
+					if (not eval_body(body, state, visitor)) { break; }
+				}
+			}
+
+			template<typename Container>
+			[[nodiscard]] static bool try_eval_container(const foundation::boxed_value& range, ast_node& body, const loop_variable_slot& loop_variable, const foundation::dispatcher_state& state, ast_visitor_base& visitor)
+			{
+				if (not range.type_info().bare_equal(typeid(Container))) { return false; }
+
+				// same as the overload chosen by the dispatcher (see bootstrap_library.hpp => register_view_type)
+				if constexpr (requires { typename Container::view_type; })
+				{
+					if (not range.is_const())
+					{
+						eval_view(boxed_cast<Container&>(range).view(), body, loop_variable, state, visitor);
+						return true;
+					}
+				}
+
+				// the views of list and dict keep their storage alive, the body may modify (or copy) the container
+				eval_view(boxed_cast<const Container&>(range).view(), body, loop_variable, state, visitor);
+				return true;
+			}
+
+			/**
+			 * @brief Find the overload that takes the view exactly, or null if it has to be dispatched every time.
+			 */
+			[[nodiscard]] static const foundation::function_proxy_base* resolve_view_function(const foundation::function_proxies_type& functions, const foundation::boxed_value& view)
+			{
+				for (const auto& function: functions)
+				{
+					// the guard may depend on the state of the view
+					if (const auto* dynamic_function = dynamic_cast<const foundation::dynamic_function_proxy_base*>(function.get());
+						dynamic_function && dynamic_function->has_guard()) { return nullptr; }
+
+					if (function->arity_size() != 1) { continue; }
+
+					if (const auto& type = function->type_view()[1];
+						type.bare_equal(view.type_info()) && (not view.is_const() || type.is_const())) { return function.get(); }
+				}
+
+				return nullptr;
+			}
+
+			static foundation::boxed_value eval_range(
+					ast_node& node,
+					view_function_locations& locations,
+					const loop_invariant_scope* invariants,
+					const foundation::boxed_value& range_expression_result,
+					const foundation::dispatcher_state& state,
+					ast_visitor_base& visitor)
 			{
-				// todo
-				const auto& loop_var_name = this->get_child(grammar::ranged_for_ast_node::loop_variable_name_index).get_child(0).identifier();
-				const auto range_expression_result = this->get_child(grammar::ranged_for_ast_node::loop_range_name_index).eval(state, visitor);
+				const auto& loop_var_name = node.get_child(grammar::ranged_for_ast_node::loop_variable_name_index).get_child(0).identifier();
+				auto& body = node.get_child(grammar::ranged_for_ast_node::body_index);
+
+				// one scope for the whole loop, the body has its own scope if it declares any variable (see ast_optimizer.hpp => block_optimizer)
+				foundation::scoped_scope scoped_scope{state};
+				if (invariants) { invariants->enter(state); }
+				// the slot of the loop variable is rebound in each iteration (the value of the previous iteration is not modified)
+				const loop_variable_slot loop_variable{state, loop_var_name, foundation::boxed_value{}};
 
 				// range_type
 				if (range_expression_result.type_info().bare_equal(typeid(types::range_type)))
 				{
 					auto& range = boxed_cast<types::range_type&>(range_expression_result);
 
+					if (range.empty()) { return void_var(); }
+
 					do
 					{
-						foundation::scoped_scope scoped_scope{state};
-						state->add_local_or_throw(loop_var_name, foundation::boxed_value{range.get()});
-
-						try { this->get_child(grammar::ranged_for_ast_node::body_index).eval(state, visitor); }
-						catch (const interrupt_type::interrupt_continue&) { }
-						catch (const interrupt_type::interrupt_break&)
-						{
-							// loop broken
-							break;
-						}
+						loop_variable.get() = foundation::boxed_value{range.get()};
+						if (not eval_body(body, state, visitor)) { break; }
 					} while (range.next());
 
 					return void_var();
 				}
 
-				// other container type
-				const auto get_function = [&state](const foundation::string_view_type name, location_type& location)
-				{
-					if (location.has_value()) { return *location; }
+				// builtin container type
+				if (
+					try_eval_container<types::list_type>(range_expression_result, body, loop_variable, state, visitor) ||
+					try_eval_container<types::dict_type>(range_expression_result, body, loop_variable, state, visitor) ||
+					try_eval_container<types::string_type>(range_expression_result, body, loop_variable, state, visitor)) { return void_var(); }
 
-					auto func = state->get_function(name);
-					location.emplace(func);
-					return func;
-				};
+				// other container type, resolve the overloads once and call them directly
+				const auto get_function = [&state](const foundation::string_view_type name, location_type& location) { return state->get_function(name, location); };
+
+				const auto view_function = get_function(foundation::container_view_interface_name::value, locations.view);
+				const auto empty_function = get_function(foundation::container_view_empty_interface_name::value, locations.empty);
+				const auto star_function = get_function(foundation::container_view_star_interface_name::value, locations.star);
+				const auto advance_function = get_function(foundation::container_view_advance_interface_name::value, locations.advance);
+
+				// get the view
+				const auto view = foundation::dispatch(*view_function, foundation::parameters_view_type{range_expression_result}, state.convertor_state());
 
-				const auto call_function = [&state](const auto& function, const auto& param) { return foundation::dispatch(*function, foundation::parameters_view_type{param}, state.convertor_state()); };
+				const auto* empty = resolve_view_function(*empty_function, view);
+				const auto* star = resolve_view_function(*star_function, view);
+				const auto* advance = resolve_view_function(*advance_function, view);
 
-				const auto view_function = get_function(foundation::container_view_interface_name::value, view_location_);
-				const auto empty_function = get_function(foundation::container_view_empty_interface_name::value, empty_location_);
-				const auto star_function = get_function(foundation::container_view_star_interface_name::value, star_location_);
-				const auto advance_function = get_function(foundation::container_view_advance_interface_name::value, advance_location_);
+				const auto call_function = [&state, &view](const auto& functions, const foundation::function_proxy_base* function)
+				{
+					if (function)
+					{
+						if (auto result = function->try_invoke(foundation::parameters_view_type{view}, state.convertor_state())) { return std::move(*result); }
+					}
+					return foundation::dispatch(*functions, foundation::parameters_view_type{view}, state.convertor_state());
+				};
 
 				for (
-					// get the view
-					const auto view = call_function(view_function, range_expression_result);
+					;
 					// while view not empty
-					not boxed_cast<bool>(call_function(empty_function, view));
+					not boxed_cast<bool>(call_function(empty_function, empty));
 					// advance the iterator
-					(void)call_function(advance_function, view))
+					(void)call_function(advance_function, advance))
 				{
-					foundation::scoped_scope scoped_scope{state};
-					// push the value into the stack
-					state->add_local_or_throw(loop_var_name, call_function(star_function, view));
-
-					try { this->get_child(grammar::ranged_for_ast_node::body_index).eval(state, visitor); }
-					catch (const interrupt_type::interrupt_continue&) { }
-					catch (const interrupt_type::interrupt_break&)
-					{
-						// loop broken
-						break;
-					}
+					loop_variable.get() = call_function(star_function, star);
+					if (not eval_body(body, state, visitor)) { break; }
 				}
 
 				return void_var();
 			}
 
+			[[nodiscard]] foundation::boxed_value do_eval(const foundation::dispatcher_state& state, ast_visitor_base& visitor) override
+			{
+				return eval_range(
+						*this,
+						locations_,
+						invariants.get(),
+						this->get_child(grammar::ranged_for_ast_node::loop_range_name_index).eval(state, visitor),
+						state,
+						visitor);
+			}
+
 		public:
 			GAL_AST_SET_RTTI(ranged_for_ast_node)
 
+			// set by the optimizer if the loop has any invariant expression
+			std::unique_ptr<loop_invariant_scope> invariants;
+
 			ranged_for_ast_node(
 					const identifier_type identifier,
 					const parse_location location,
@@ -1363,33 +2343,103 @@ namespace gal::lang
 				: ast_node{get_rtti_index(), identifier, location, std::move(children)} { gal_assert(this->size() == 3); }
 		};
 
-		struct break_ast_node final : ast_node
+		struct counted_for_ast_node final : ast_node
 		{
 		private:
-			[[nodiscard]] foundation::boxed_value do_eval(const foundation::dispatcher_state&, ast_visitor_base&) override
-			{
-				// todo: better way
-				throw interrupt_type::interrupt_break{};
-			}
-
-		public:
-			GAL_AST_SET_RTTI(break_ast_node)
+			using size_type = types::range_type::size_type;
 
-			break_ast_node(
-					const identifier_type identifier,
-					const parse_location location,
-					children_type&& children)
-				: ast_node{get_rtti_index(), identifier, location, std::move(children)} {}
-		};
+			mutable ranged_for_ast_node::view_function_locations locations_{};
 
-		struct continue_ast_node final : ast_node
-		{
-		private:
-			[[nodiscard]] foundation::boxed_value do_eval(const foundation::dispatcher_state&, ast_visitor_base&) override
+			[[nodiscard]] foundation::boxed_value do_eval(const foundation::dispatcher_state& state, ast_visitor_base& visitor) override
 			{
-				// todo: better way
-				throw interrupt_type::interrupt_continue{};
-			}
+				const auto range_expression_result = this->get_child(grammar::counted_for_ast_node::loop_range_name_index).eval(state, visitor);
+
+				// 'range' may be overloaded, iterate it like any other container
+				if (not range_expression_result.type_info().bare_equal(typeid(types::range_type))) { return ranged_for_ast_node::eval_range(*this, locations_, invariants.get(), range_expression_result, state, visitor); }
+
+				const auto& range = boxed_cast<const types::range_type&>(range_expression_result);
+				const auto end = range.end();
+				const auto step = range.step();
+
+				const auto& loop_var_name = this->get_child(grammar::counted_for_ast_node::loop_variable_name_index).get_child(0).identifier();
+				auto& body = this->get_child(grammar::counted_for_ast_node::body_index);
+
+				foundation::scoped_scope scoped_scope{state};
+				if (invariants) { invariants->enter(state); }
+				const ranged_for_ast_node::loop_variable_slot slot{state, loop_var_name, foundation::boxed_value{range.begin()}};
+
+				// the body scope is created once and cleared after each iteration
+				const bool scoped_body = body.is<block_ast_node>();
+				foundation::scoped_scope body_scope{state};
+
+				for (auto index = range.begin(); step > 0 ? index < end : (step < 0 && index > end); index += step)
+				{
+					auto& loop_variable = slot.get();
+					// nobody else holds the loop variable, update it in place
+					if (
+						loop_variable.use_count() == 1 &&
+						not loop_variable.is_const() &&
+						loop_variable.type_info().bare_equal(typeid(size_type))) { *static_cast<size_type*>(loop_variable.get_raw()) = index; }
+					else { loop_variable = foundation::boxed_value{index}; }
+
+					try
+					{
+						if (scoped_body) { std::ranges::for_each(body.view(), [&state, &visitor](auto& c) { (void)c.eval(state, visitor); }); }
+						else { (void)body.eval(state, visitor); }
+					}
+					catch (const interrupt_type::interrupt_continue&) { }
+					catch (const interrupt_type::interrupt_break&)
+					{
+						// loop broken
+						break;
+					}
+
+					state.stack().clear_scope(GAL_LANG_RECODE_CALL_LOCATION_DEBUG_DO("counted_for_ast_node next iteration"));
+				}
+
+				return void_var();
+			}
+
+		public:
+			GAL_AST_SET_RTTI(counted_for_ast_node)
+
+			// set by the optimizer if the loop has any invariant expression
+			std::unique_ptr<loop_invariant_scope> invariants;
+
+			counted_for_ast_node(
+					const identifier_type identifier,
+					const parse_location location,
+					children_type&& children)
+				: ast_node{get_rtti_index(), identifier, location, std::move(children)} { gal_assert(this->size() == 3); }
+		};
+
+		struct break_ast_node final : ast_node
+		{
+		private:
+			[[nodiscard]] foundation::boxed_value do_eval(const foundation::dispatcher_state&, ast_visitor_base&) override
+			{
+				// todo: better way
+				throw interrupt_type::interrupt_break{};
+			}
+
+		public:
+			GAL_AST_SET_RTTI(break_ast_node)
+
+			break_ast_node(
+					const identifier_type identifier,
+					const parse_location location,
+					children_type&& children)
+				: ast_node{get_rtti_index(), identifier, location, std::move(children)} {}
+		};
+
+		struct continue_ast_node final : ast_node
+		{
+		private:
+			[[nodiscard]] foundation::boxed_value do_eval(const foundation::dispatcher_state&, ast_visitor_base&) override
+			{
+				// todo: better way
+				throw interrupt_type::interrupt_continue{};
+			}
 
 		public:
 			GAL_AST_SET_RTTI(continue_ast_node)
@@ -1515,24 +2565,35 @@ namespace gal::lang
 				: ast_node{get_rtti_index(), identifier, location, std::move(children)} { gal_assert(this->empty()); }
 		};
 
+		struct constant_match_ast_node;
+
 		struct match_ast_node final : ast_node
 		{
+			friend struct constant_match_ast_node;
+
 		private:
-			mutable foundation::dispatcher::function_cache_location_type location_;
+			using location_type = foundation::dispatcher::function_cache_location_type;
 
-			[[nodiscard]] foundation::boxed_value do_eval(const foundation::dispatcher_state& state, ast_visitor_base& visitor) override
+			mutable location_type location_;
+
+			/**
+			 * @brief Evaluate the cases from the first_case, if has_matched then the first_case is evaluated without comparing (it is the target of a jump).
+			 */
+			static void eval_cases(
+					ast_node& node,
+					location_type& location,
+					std::array<foundation::boxed_value, 2>& match_value,
+					const children_type::difference_type first_case,
+					bool has_matched,
+					const foundation::dispatcher_state& state,
+					ast_visitor_base& visitor)
 			{
-				foundation::scoped_scope scoped_scope{state};
-
-				std::array<foundation::boxed_value, 2> match_value{this->get_child(grammar::match_ast_node::match_value_index).eval(state, visitor)};
-
 				bool breaking = false;
-				children_type::difference_type current_case = 0;
-				bool has_matched = false;
-				// from 1 to size
-				while (not breaking && ++current_case < static_cast<children_type::difference_type>(this->size()))
+				children_type::difference_type current_case = first_case - 1;
+				// from first_case to size
+				while (not breaking && ++current_case < static_cast<children_type::difference_type>(node.size()))
 				{
-					if (auto& current = this->get_child(current_case); current.is<match_case_ast_node>())
+					if (auto& current = node.get_child(current_case); current.is<match_case_ast_node>())
 					{
 						try
 						{
@@ -1540,13 +2601,13 @@ namespace gal::lang
 								// fallthrough
 								has_matched ||
 								// new match
-								[&state, &visitor, this, &match_value, &current]
+								[&state, &visitor, &location, &match_value, &current]
 								{
 									match_value[1] = current.get_child(grammar::match_case_ast_node::match_value_index).eval(state, visitor);
 									return boxed_cast<bool>(
 											state->call_function(
 													foundation::operator_equal_name::value,
-													location_,
+													location,
 													match_value));
 								}())
 							{
@@ -1573,6 +2634,15 @@ namespace gal::lang
 						breaking = true;
 					}
 				}
+			}
+
+			[[nodiscard]] foundation::boxed_value do_eval(const foundation::dispatcher_state& state, ast_visitor_base& visitor) override
+			{
+				foundation::scoped_scope scoped_scope{state};
+
+				std::array<foundation::boxed_value, 2> match_value{this->get_child(grammar::match_ast_node::match_value_index).eval(state, visitor)};
+
+				eval_cases(*this, location_, match_value, 1, false, state, visitor);
 
 				return void_var();
 			}
@@ -1587,6 +2657,140 @@ namespace gal::lang
 				: ast_node{get_rtti_index(), identifier, location, std::move(children)} {}
 		};
 
+		struct constant_match_ast_node final : ast_node
+		{
+		private:
+			using index_type = children_type::difference_type;
+
+			mutable match_ast_node::location_type location_;
+
+			// the first case of each value (the later cases with the same value are never matched)
+			std::unordered_map<std::int64_t, index_type> integral_cases_;
+			bool integral_signed_;
+			// the integral values are dense, jump directly
+			std::vector<index_type> dense_cases_;
+			std::int64_t dense_base_;
+
+			std::unordered_map<types::string_type, index_type> string_cases_;
+
+			// the default case, or size() if there is no default case
+			index_type default_case_;
+
+			/**
+			 * @brief Find the case to jump to, or nothing if the value cannot be compared through the table.
+			 */
+			[[nodiscard]] std::optional<index_type> find_case(const foundation::boxed_value& value) const
+			{
+				// the cases after the default case are never reached without a match
+				const auto jump = [this](const index_type target) { return std::ranges::min(target, default_case_); };
+
+				if (not string_cases_.empty())
+				{
+					if (not value.type_info().bare_equal(types::string_type::class_type())) { return std::nullopt; }
+
+					const auto it = string_cases_.find(boxed_cast<const types::string_type&>(value));
+					return jump(it == string_cases_.end() ? static_cast<index_type>(this->size()) : it->second);
+				}
+
+				const auto key = types::number_type::integral_key(value);
+				// the values with different signedness are compared after wrapping (see number_type::do_binary_invoke)
+				if (not key.has_value() || key->second != integral_signed_) { return std::nullopt; }
+
+				if (not dense_cases_.empty())
+				{
+					if (const auto offset = static_cast<std::uint64_t>(key->first) - static_cast<std::uint64_t>(dense_base_);
+						offset < dense_cases_.size()) { return jump(dense_cases_[static_cast<std::size_t>(offset)]); }
+					return jump(static_cast<index_type>(this->size()));
+				}
+
+				const auto it = integral_cases_.find(key->first);
+				return jump(it == integral_cases_.end() ? static_cast<index_type>(this->size()) : it->second);
+			}
+
+			void build_table()
+			{
+				const auto size = static_cast<index_type>(this->size());
+				default_case_ = size;
+
+				for (index_type i = 1; i < size; ++i)
+				{
+					const auto& current = this->get_child(i);
+					if (current.is<match_default_ast_node>())
+					{
+						default_case_ = std::ranges::min(default_case_, i);
+						continue;
+					}
+
+					const auto& value = dynamic_cast<const constant_ast_node&>(current.get_child(grammar::match_case_ast_node::match_value_index)).value;
+					if (value.type_info().bare_equal(types::string_type::class_type())) { string_cases_.try_emplace(boxed_cast<const types::string_type&>(value), i); }
+					else
+					{
+						const auto key = types::number_type::integral_key(value);
+						gal_assert(key.has_value());
+						integral_signed_ = key->second;
+						integral_cases_.try_emplace(key->first, i);
+					}
+				}
+
+				gal_assert(string_cases_.empty() || integral_cases_.empty());
+
+				if (integral_cases_.empty()) { return; }
+
+				const auto [min, max] = std::ranges::minmax(integral_cases_ | std::views::keys);
+				// not too sparse
+				if (const auto span = static_cast<std::uint64_t>(max) - static_cast<std::uint64_t>(min);
+					span < dense_table_factor * integral_cases_.size())
+				{
+					dense_base_ = min;
+					dense_cases_.resize(static_cast<std::size_t>(span) + 1, size);
+					for (const auto& [key, index]: integral_cases_) { dense_cases_[static_cast<std::size_t>(static_cast<std::uint64_t>(key) - static_cast<std::uint64_t>(min))] = index; }
+				}
+			}
+
+			[[nodiscard]] foundation::boxed_value do_eval(const foundation::dispatcher_state& state, ast_visitor_base& visitor) override
+			{
+				foundation::scoped_scope scoped_scope{state};
+
+				std::array<foundation::boxed_value, 2> match_value{this->get_child(grammar::constant_match_ast_node::match_value_index).eval(state, visitor)};
+
+				if (const auto target = find_case(match_value[0]);
+					target.has_value())
+				{
+					// no case matched and no default case
+					if (*target == static_cast<index_type>(this->size())) { return void_var(); }
+
+					match_ast_node::eval_cases(*this, location_, match_value, *target, true, state, visitor);
+				}
+				else
+				{
+					// compare the cases one by one
+					match_ast_node::eval_cases(*this, location_, match_value, 1, false, state, visitor);
+				}
+
+				return void_var();
+			}
+
+		public:
+			GAL_AST_SET_RTTI(constant_match_ast_node)
+
+			// the integral values are stored in a dense table if (max - min) < factor * count
+			constexpr static std::size_t dense_table_factor = 4;
+
+			constant_match_ast_node(
+					const identifier_type identifier,
+					const parse_location location,
+					children_type&& children)
+				: ast_node{get_rtti_index(), identifier, location, std::move(children)},
+				  integral_signed_{true},
+				  dense_base_{0},
+				  default_case_{0} { build_table(); }
+
+			/**
+			 * @brief Whether the integral values are looked up in the dense table (instead of the hash table).
+			 */
+			[[nodiscard]] bool is_dense() const noexcept { return not dense_cases_.empty(); }
+		};
+
 		struct logical_and_ast_node final : ast_node
 		{
 		private:
@@ -1861,6 +3065,666 @@ namespace gal::lang
 		}
 	}
 
+	namespace eval_detail
+	{
+		/**
+		 * @brief Whether the function is a script function (or an overload set of them) that returns directly to the trampoline.
+		 */
+		[[nodiscard]] inline bool is_trampoline_callee(const foundation::boxed_value& function, const foundation::dispatcher_state& state)
+		{
+			const foundation::function_proxy_base* proxy;
+			// not a function, the call reports it
+			try { proxy = state->boxed_cast<const foundation::function_proxy_base*>(function); }
+			catch (const exception::bad_boxed_cast&) { return false; }
+
+			const auto is_script_function = [](const auto* f)
+			{
+				const auto* dynamic_function = dynamic_cast<const foundation::dynamic_function_proxy_base*>(f);
+				return dynamic_function && not dynamic_function->has_guard();
+			};
+
+			if (is_script_function(proxy)) { return true; }
+			if (dynamic_cast<const foundation::dispatch_function*>(proxy))
+			{
+				return std::ranges::all_of(
+						proxy->overloaded_functions(),
+						[&is_script_function](const auto& f) { return is_script_function(f.get()); });
+			}
+			return false;
+		}
+
+		inline foundation::boxed_value eval_tail_calls(const foundation::dispatcher_state& state)
+		{
+			auto& stack = state.stack();
+
+			const auto previous_location = stack.trampoline_location;
+			foundation::boxed_value result{};
+
+			try
+			{
+				while (stack.tail_call.has_value())
+				{
+					auto tail_call = std::move(*stack.tail_call);
+					stack.tail_call.reset();
+
+					const foundation::scoped_function_scope function_scope{state};
+
+					// the callee (if it is a script function) leaves its tail call pending instead of making it,
+					// others (native functions, guarded functions) may call a script function that does not return to here
+					stack.trampoline_location = {stack.stacks.size(), is_trampoline_callee(tail_call.function, state) ? stack.depth : -1};
+					result = ast::fun_call_ast_node::call_function(*tail_call.function_node, tail_call.function, tail_call.params, state);
+					stack.save_params(tail_call.params);
+				}
+			}
+			catch (...)
+			{
+				stack.tail_call.reset();
+				stack.trampoline_location = previous_location;
+				throw;
+			}
+
+			stack.trampoline_location = previous_location;
+			return result;
+		}
+
+		/**
+		 * @brief A script function body compiled for double arguments (the numeric tier).
+		 * The body becomes a tree of closures over a frame of unboxed doubles (the parameters and the local variables), so neither the ast nor the boxed values are involved in the call.
+		 *
+		 * @note Only the bodies whose values are all doubles or ints (and the conditions bools) can be compiled: the constants, parameters and local variables,
+		 * the arithmetic operators (+ - * /), the comparisons, the logical operators, variable declarations, (compound) assignments of the local variables, if, while and return.
+		 * The results are the same as number_type computes (see number_type::do_binary_invoke), integer constants are converted as number_type converts them.
+		 * An int local variable (such as a loop counter) keeps its int value in the frame, the arithmetic of two ints stays int (+ - * only).
+		 */
+		class numeric_function
+		{
+		public:
+			using identifier_type = ast::ast_node::identifier_type;
+			using frame_type = std::vector<double>;
+			using slot_type = frame_type::size_type;
+
+			struct result_type
+			{
+				enum class kind_type
+				{
+					nothing,
+					// a temporary number
+					number,
+					// the value of a local variable
+					local,
+					// a temporary int
+					integer,
+					// the value of an int local variable
+					integer_local,
+					boolean,
+				};
+
+				kind_type kind = kind_type::nothing;
+				double number = 0;
+				bool boolean = false;
+			};
+
+			using number_type = std::function<double(frame_type&)>;
+			using condition_type = std::function<bool(frame_type&)>;
+			// return true if the function returns
+			using statement_type = std::function<bool(frame_type&, result_type&)>;
+
+		private:
+			class compiler
+			{
+			public:
+				using scope_type = std::vector<std::pair<identifier_type, slot_type>>;
+
+			private:
+				std::vector<scope_type> scopes_;
+				slot_type num_params_;
+				slot_type num_slots_;
+				// whether each slot holds an int (instead of a double)
+				std::vector<bool> integer_slots_;
+
+				[[nodiscard]] slot_type add_slot(const identifier_type name, const bool is_integer)
+				{
+					scopes_.back().emplace_back(name, num_slots_);
+					integer_slots_.push_back(is_integer);
+					return num_slots_++;
+				}
+
+				// the arithmetic of two ints stays int, and wraps around as int does
+				[[nodiscard]] static double to_integer(const double value) noexcept { return static_cast<double>(static_cast<int>(static_cast<std::int64_t>(value))); }
+
+				[[nodiscard]] std::optional<slot_type> find(const identifier_type name) const
+				{
+					for (const auto& scope: scopes_ | std::views::reverse)
+					{
+						if (const auto it = std::ranges::find(scope, name, &scope_type::value_type::first); it != scope.end()) { return it->second; }
+					}
+					return std::nullopt;
+				}
+
+				[[nodiscard]] std::optional<slot_type> find_local(const ast::ast_node& node) const
+				{
+					if (not node.is_any<ast::id_ast_node, ast::last_use_id_ast_node>()) { return std::nullopt; }
+					if (const auto slot = find(node.identifier()); slot.has_value() && *slot >= num_params_) { return slot; }
+					return std::nullopt;
+				}
+
+				[[nodiscard]] bool is_parameter(const ast::ast_node& node) const
+				{
+					if (not node.is_any<ast::id_ast_node, ast::last_use_id_ast_node>()) { return false; }
+					const auto slot = find(node.identifier());
+					return slot.has_value() && *slot < num_params_;
+				}
+
+				/**
+				 * @brief A constant operand of an arithmetic operation (with a double operand), an integer constant is converted as the operation converts it.
+				 */
+				[[nodiscard]] static number_type compile_constant(const foundation::boxed_value& value, bool& is_double)
+				{
+					is_double = value.type_info().bare_equal(typeid(double));
+					if (is_double) { return [number = *static_cast<const double*>(value.get_const_raw())](frame_type&) { return number; }; }
+					if (not value.type_info().is_arithmetic()) { return nullptr; }
+
+					const auto converted = types::number_type::binary_invoke(foundation::algebraic_operations::plus, const_var(0.0), value);
+					if (not converted.type_info().bare_equal(typeid(double))) { return nullptr; }
+					return [number = *static_cast<const double*>(converted.get_const_raw())](frame_type&) { return number; };
+				}
+
+				[[nodiscard]] static number_type compile_integer_constant(const foundation::boxed_value& value)
+				{
+					if (not value.type_info().bare_equal(typeid(int))) { return nullptr; }
+					return [number = static_cast<double>(*static_cast<const int*>(value.get_const_raw()))](frame_type&) { return number; };
+				}
+
+				// the division by an integer zero throws (see number_type::divide_zero_protect), the integer divisor has to be a non-zero constant
+				[[nodiscard]] static bool is_non_zero_constant(const ast::ast_node& node)
+				{
+					if (not node.is<ast::constant_ast_node>()) { return false; }
+
+					bool is_double;
+					frame_type frame{};
+					const auto number = compile_constant(dynamic_cast<const ast::constant_ast_node&>(node).value, is_double);
+					return number && number(frame) != 0;
+				}
+
+				[[nodiscard]] number_type compile_operand(const ast::ast_node& node, bool& is_double)
+				{
+					if (node.is<ast::constant_ast_node>()) { return compile_constant(dynamic_cast<const ast::constant_ast_node&>(node).value, is_double); }
+
+					is_double = true;
+					if (auto number = compile_number(node)) { return number; }
+
+					is_double = false;
+					return compile_integer(node);
+				}
+
+				template<typename Operation>
+				[[nodiscard]] static number_type make_arithmetic(number_type&& lhs, number_type&& rhs, const Operation operation) { return [lhs = std::move(lhs), rhs = std::move(rhs), operation](frame_type& frame) { return operation(lhs(frame), rhs(frame)); }; }
+
+				[[nodiscard]] static number_type compile_arithmetic(const foundation::algebraic_operations operation, number_type&& lhs, const bool is_lhs_double, number_type&& rhs, const bool is_rhs_double)
+				{
+					if (not lhs || not rhs || not(is_lhs_double || is_rhs_double)) { return nullptr; }
+
+					switch (operation)// NOLINT(clang-diagnostic-switch-enum)
+					{
+							using enum foundation::algebraic_operations;
+						case plus: { return make_arithmetic(std::move(lhs), std::move(rhs), std::plus<>{}); }
+						case minus: { return make_arithmetic(std::move(lhs), std::move(rhs), std::minus<>{}); }
+						case multiply: { return make_arithmetic(std::move(lhs), std::move(rhs), std::multiplies<>{}); }
+						case divide: { return make_arithmetic(std::move(lhs), std::move(rhs), std::divides<>{}); }
+						default: { return nullptr; }
+					}
+				}
+
+				[[nodiscard]] static condition_type compile_comparison(const foundation::algebraic_operations operation, number_type&& lhs, const bool is_lhs_double, number_type&& rhs, const bool is_rhs_double)
+				{
+					// the ints are exact in the frame, they are compared as they are
+					if (not lhs || not rhs) { return nullptr; }
+
+					// see number_type::do_binary_invoke => floating_point_compare
+					constexpr auto floating_point_compare = [](const double l, const double r) { return l - r < std::numeric_limits<double>::epsilon() && r - r < std::numeric_limits<double>::epsilon(); };
+
+					switch (operation)// NOLINT(clang-diagnostic-switch-enum)
+					{
+							using enum foundation::algebraic_operations;
+						// an integer constant is compared as an integer
+						case equal:
+						{
+							if (not is_lhs_double || not is_rhs_double) { return [lhs = std::move(lhs), rhs = std::move(rhs)](frame_type& frame) { return lhs(frame) == rhs(frame); }; }
+							return [lhs = std::move(lhs), rhs = std::move(rhs), floating_point_compare](frame_type& frame) { return floating_point_compare(lhs(frame), rhs(frame)); };
+						}
+						case not_equal:
+						{
+							if (not is_lhs_double || not is_rhs_double) { return [lhs = std::move(lhs), rhs = std::move(rhs)](frame_type& frame) { return lhs(frame) != rhs(frame); }; }
+							return [lhs = std::move(lhs), rhs = std::move(rhs), floating_point_compare](frame_type& frame) { return not floating_point_compare(lhs(frame), rhs(frame)); };
+						}
+						case less_than: { return [lhs = std::move(lhs), rhs = std::move(rhs)](frame_type& frame) { return lhs(frame) < rhs(frame); }; }
+						case less_equal: { return [lhs = std::move(lhs), rhs = std::move(rhs)](frame_type& frame) { return lhs(frame) <= rhs(frame); }; }
+						case greater_than: { return [lhs = std::move(lhs), rhs = std::move(rhs)](frame_type& frame) { return lhs(frame) > rhs(frame); }; }
+						case greater_equal: { return [lhs = std::move(lhs), rhs = std::move(rhs)](frame_type& frame) { return lhs(frame) >= rhs(frame); }; }
+						default: { return nullptr; }
+					}
+				}
+
+				/**
+				 * @brief The operands of a binary_operator_ast_node or fold_right_binary_operator_ast_node (its right hand side is a constant).
+				 */
+				template<typename Compile>
+				[[nodiscard]] auto compile_binary(const ast::ast_node& node, const Compile compile) -> decltype(compile(foundation::algebraic_operations::unknown, number_type{}, false, number_type{}, false))
+				{
+					const auto operation = foundation::algebraic_operation(node.identifier());
+
+					bool is_lhs_double;
+					bool is_rhs_double;
+					auto lhs = compile_operand(node.get_child(grammar::binary_operator_ast_node::lhs_index), is_lhs_double);
+					auto rhs = node.is<ast::binary_operator_ast_node>()
+						           ? compile_operand(node.get_child(grammar::binary_operator_ast_node::rhs_index), is_rhs_double)
+						           : compile_constant(dynamic_cast<const ast::fold_right_binary_operator_ast_node&>(node).rhs(), is_rhs_double);
+
+					if (operation == foundation::algebraic_operations::divide && not is_rhs_double)
+					{
+						frame_type frame{};
+						// the rhs of fold_right_binary_operator_ast_node is always a constant
+						const bool is_constant = node.is<ast::fold_right_binary_operator_ast_node>() || node.get_child(grammar::binary_operator_ast_node::rhs_index).is<ast::constant_ast_node>();
+						if (not rhs || not is_constant || rhs(frame) == 0) { return nullptr; }
+					}
+
+					return compile(operation, std::move(lhs), is_lhs_double, std::move(rhs), is_rhs_double);
+				}
+
+				/**
+				 * @brief An int expression, the int constants and local variables, the arithmetic (+ - *) of them.
+				 */
+				[[nodiscard]] number_type compile_integer(const ast::ast_node& node)
+				{
+					if (node.is<ast::loop_invariant_ast_node>()) { return compile_integer(node.get_child(grammar::loop_invariant_ast_node::expression_index)); }
+
+					if (node.is<ast::constant_ast_node>()) { return compile_integer_constant(dynamic_cast<const ast::constant_ast_node&>(node).value); }
+
+					if (node.is_any<ast::id_ast_node, ast::last_use_id_ast_node>())
+					{
+						if (const auto slot = find(node.identifier()); slot.has_value() && integer_slots_[*slot]) { return [slot = *slot](frame_type& frame) { return frame[slot]; }; }
+						return nullptr;
+					}
+
+					if (node.is_any<ast::binary_operator_ast_node, ast::fold_right_binary_operator_ast_node>())
+					{
+						auto lhs = compile_integer(node.get_child(grammar::binary_operator_ast_node::lhs_index));
+						auto rhs = node.is<ast::binary_operator_ast_node>()
+							           ? compile_integer(node.get_child(grammar::binary_operator_ast_node::rhs_index))
+							           : compile_integer_constant(dynamic_cast<const ast::fold_right_binary_operator_ast_node&>(node).rhs());
+						if (not lhs || not rhs) { return nullptr; }
+
+						switch (foundation::algebraic_operation(node.identifier()))// NOLINT(clang-diagnostic-switch-enum)
+						{
+								using enum foundation::algebraic_operations;
+							case plus: { return make_arithmetic(std::move(lhs), std::move(rhs), [](const double l, const double r) { return to_integer(l + r); }); }
+							case minus: { return make_arithmetic(std::move(lhs), std::move(rhs), [](const double l, const double r) { return to_integer(l - r); }); }
+							case multiply: { return make_arithmetic(std::move(lhs), std::move(rhs), [](const double l, const double r) { return to_integer(l * r); }); }
+							default: { return nullptr; }
+						}
+					}
+
+					if (node.is<ast::unary_operator_ast_node>() && foundation::algebraic_operation(node.identifier(), true) == foundation::algebraic_operations::unary_minus)
+					{
+						if (auto self = compile_integer(node.get_child(grammar::unary_operator_ast_node::index))) { return [self = std::move(self)](frame_type& frame) { return to_integer(-self(frame)); }; }
+					}
+
+					return nullptr;
+				}
+
+				[[nodiscard]] number_type compile_number(const ast::ast_node& node)
+				{
+					if (node.is<ast::loop_invariant_ast_node>()) { return compile_number(node.get_child(grammar::loop_invariant_ast_node::expression_index)); }
+
+					if (node.is<ast::constant_ast_node>())
+					{
+						if (const auto& value = dynamic_cast<const ast::constant_ast_node&>(node).value; value.type_info().bare_equal(typeid(double))) { return [number = *static_cast<const double*>(value.get_const_raw())](frame_type&) { return number; }; }
+						return nullptr;
+					}
+
+					if (node.is_any<ast::id_ast_node, ast::last_use_id_ast_node>())
+					{
+						if (const auto slot = find(node.identifier()); slot.has_value() && not integer_slots_[*slot]) { return [slot = *slot](frame_type& frame) { return frame[slot]; }; }
+						return nullptr;
+					}
+
+					if (node.is_any<ast::binary_operator_ast_node, ast::fold_right_binary_operator_ast_node>()) { return compile_binary(node, compile_arithmetic); }
+
+					if (node.is<ast::unary_operator_ast_node>())
+					{
+						auto self = compile_number(node.get_child(grammar::unary_operator_ast_node::index));
+						if (not self) { return nullptr; }
+
+						switch (foundation::algebraic_operation(node.identifier(), true))// NOLINT(clang-diagnostic-switch-enum)
+						{
+								using enum foundation::algebraic_operations;
+							case unary_plus: { return self; }
+							case unary_minus: { return [self = std::move(self)](frame_type& frame) { return -self(frame); }; }
+							default: { return nullptr; }
+						}
+					}
+
+					return nullptr;
+				}
+
+				[[nodiscard]] condition_type compile_condition(const ast::ast_node& node)
+				{
+					if (node.is<ast::loop_invariant_ast_node>()) { return compile_condition(node.get_child(grammar::loop_invariant_ast_node::expression_index)); }
+
+					if (node.is<ast::constant_ast_node>())
+					{
+						if (const auto& value = dynamic_cast<const ast::constant_ast_node&>(node).value; value.type_info().bare_equal(typeid(bool))) { return [boolean = *static_cast<const bool*>(value.get_const_raw())](frame_type&) { return boolean; }; }
+						return nullptr;
+					}
+
+					if (node.is_any<ast::binary_operator_ast_node, ast::fold_right_binary_operator_ast_node>()) { return compile_binary(node, compile_comparison); }
+
+					if (node.is_any<ast::logical_and_ast_node, ast::logical_or_ast_node>())
+					{
+						auto lhs = compile_condition(node.get_child(grammar::logical_and_ast_node::lhs_index));
+						auto rhs = compile_condition(node.get_child(grammar::logical_and_ast_node::rhs_index));
+						if (not lhs || not rhs) { return nullptr; }
+
+						if (node.is<ast::logical_and_ast_node>()) { return [lhs = std::move(lhs), rhs = std::move(rhs)](frame_type& frame) { return lhs(frame) && rhs(frame); }; }
+						return [lhs = std::move(lhs), rhs = std::move(rhs)](frame_type& frame) { return lhs(frame) || rhs(frame); };
+					}
+
+					return nullptr;
+				}
+
+				/**
+				 * @brief The value of the expression is the result of the function if it is the last one evaluated (is_tail).
+				 */
+				[[nodiscard]] statement_type compile_expression(const ast::ast_node& node, const bool is_tail)
+				{
+					// the parameter itself (shared with the caller) cannot be returned
+					if (is_tail && is_parameter(node)) { return nullptr; }
+
+					if (auto number = compile_number(node))
+					{
+						const auto kind = find_local(node).has_value() ? result_type::kind_type::local : result_type::kind_type::number;
+						if (not is_tail) { return [](frame_type&, result_type&) { return false; }; }
+						return [number = std::move(number), kind](frame_type& frame, result_type& result)
+						{
+							result = {.kind = kind, .number = number(frame)};
+							return false;
+						};
+					}
+
+					if (auto number = compile_integer(node))
+					{
+						const auto kind = find_local(node).has_value() ? result_type::kind_type::integer_local : result_type::kind_type::integer;
+						if (not is_tail) { return [](frame_type&, result_type&) { return false; }; }
+						return [number = std::move(number), kind](frame_type& frame, result_type& result)
+						{
+							result = {.kind = kind, .number = number(frame)};
+							return false;
+						};
+					}
+
+					if (auto condition = compile_condition(node))
+					{
+						if (not is_tail) { return [](frame_type&, result_type&) { return false; }; }
+						return [condition = std::move(condition)](frame_type& frame, result_type& result)
+						{
+							result = {.kind = result_type::kind_type::boolean, .boolean = condition(frame)};
+							return false;
+						};
+					}
+
+					return nullptr;
+				}
+
+				[[nodiscard]] statement_type compile_block(const ast::ast_node& node, const bool is_tail, const bool is_scoped)
+				{
+					if (node.empty()) { return nullptr; }
+
+					if (is_scoped) { scopes_.emplace_back(); }
+
+					std::vector<statement_type> statements;
+					for (decltype(node.size()) i = 0; i < node.size(); ++i)
+					{
+						auto statement = compile_statement(node.get_child(static_cast<ast::ast_node::children_type::difference_type>(i)), is_tail && i == node.size() - 1);
+						if (not statement) { return nullptr; }
+						statements.push_back(std::move(statement));
+					}
+
+					if (is_scoped) { scopes_.pop_back(); }
+
+					return [statements = std::move(statements)](frame_type& frame, result_type& result) { return std::ranges::any_of(statements, [&frame, &result](const auto& statement) { return statement(frame, result); }); };
+				}
+
+				[[nodiscard]] statement_type compile_statement(const ast::ast_node& node, const bool is_tail)
+				{
+					if (node.is<ast::block_ast_node>()) { return compile_block(node, is_tail, true); }
+					if (node.is<ast::no_scope_block_ast_node>()) { return compile_block(node, is_tail, false); }
+
+					if (node.is<ast::noop_ast_node>())
+					{
+						if (not is_tail) { return [](frame_type&, result_type&) { return false; }; }
+						return [](frame_type&, result_type& result)
+						{
+							result = {};
+							return false;
+						};
+					}
+
+					if (node.is<ast::return_ast_node>())
+					{
+						if (node.empty())
+						{
+							return [](frame_type&, result_type& result)
+							{
+								result = {};
+								return true;
+							};
+						}
+
+						auto value = compile_expression(node.get_child(grammar::return_ast_node::operation_index), true);
+						if (not value) { return nullptr; }
+						return [value = std::move(value)](frame_type& frame, result_type& result)
+						{
+							(void)value(frame, result);
+							return true;
+						};
+					}
+
+					if (node.is<ast::assign_decl_ast_node>())
+					{
+						const auto name = node.get_child(grammar::assign_decl_ast_node::lhs_index).identifier();
+						// the shadowing is left to the interpreter
+						if (find(name).has_value()) { return nullptr; }
+
+						const auto& rhs = node.get_child(grammar::assign_decl_ast_node::rhs_index);
+						auto value = compile_number(rhs);
+						const bool is_integer = not value;
+						if (is_integer) { value = compile_integer(rhs); }
+						if (not value) { return nullptr; }
+
+						const auto slot = add_slot(name, is_integer);
+						const auto kind = is_integer ? result_type::kind_type::integer_local : result_type::kind_type::local;
+
+						return [value = std::move(value), slot, is_tail, kind](frame_type& frame, result_type& result)
+						{
+							frame[slot] = value(frame);
+							if (is_tail) { result = {.kind = kind, .number = frame[slot]}; }
+							return false;
+						};
+					}
+
+					if (node.is<ast::equation_ast_node>())
+					{
+						// only the local variables, the parameters are shared with the caller
+						const auto slot = find_local(node.get_child(grammar::equation_ast_node::lhs_index));
+						if (not slot.has_value()) { return nullptr; }
+
+						const bool is_integer = integer_slots_[*slot];
+
+						const auto& rhs = node.get_child(grammar::equation_ast_node::rhs_index);
+
+						bool is_double = false;
+						// the int local stays int, only the int values can be assigned to it
+						auto value = is_integer ? compile_integer(rhs) : compile_operand(rhs, is_double);
+						if (not value) { return nullptr; }
+
+						const auto assign = [&value, slot = *slot, is_tail, is_integer](const auto operation) -> statement_type
+						{
+							if (is_integer)
+							{
+								return [value = std::move(value), slot, is_tail, operation](frame_type& frame, result_type& result)
+								{
+									frame[slot] = to_integer(operation(frame[slot], value(frame)));
+									if (is_tail) { result = {.kind = result_type::kind_type::integer_local, .number = frame[slot]}; }
+									return false;
+								};
+							}
+
+							return [value = std::move(value), slot, is_tail, operation](frame_type& frame, result_type& result)
+							{
+								frame[slot] = operation(frame[slot], value(frame));
+								if (is_tail) { result = {.kind = result_type::kind_type::local, .number = frame[slot]}; }
+								return false;
+							};
+						};
+
+						switch (foundation::algebraic_operation(node.identifier()))// NOLINT(clang-diagnostic-switch-enum)
+						{
+								using enum foundation::algebraic_operations;
+							case assign: { return assign([](double, const double rhs) { return rhs; }); }
+							case plus_assign: { return assign(std::plus<>{}); }
+							case minus_assign: { return assign(std::minus<>{}); }
+							case multiply_assign: { return assign(std::multiplies<>{}); }
+							case divide_assign:
+							{
+								// the int division (and the division by an int) is left to the interpreter
+								if (is_integer || (not is_double && not is_non_zero_constant(rhs))) { return nullptr; }
+								return assign(std::divides<>{});
+							}
+							default: { return nullptr; }
+						}
+					}
+
+					if (node.is<ast::if_ast_node>())
+					{
+						auto condition = compile_condition(node.get_child(grammar::if_ast_node::condition_index));
+						auto true_branch = compile_statement(node.get_child(grammar::if_ast_node::true_branch_index), is_tail);
+						auto false_branch = compile_statement(node.get_child(grammar::if_ast_node::false_branch_index), is_tail);
+						if (not condition || not true_branch || not false_branch) { return nullptr; }
+
+						return [condition = std::move(condition), true_branch = std::move(true_branch), false_branch = std::move(false_branch)](frame_type& frame, result_type& result)
+						{
+							if (condition(frame)) { return true_branch(frame, result); }
+							return false_branch(frame, result);
+						};
+					}
+
+					if (node.is<ast::while_ast_node>())
+					{
+						scopes_.emplace_back();
+						auto condition = compile_condition(node.get_child(grammar::while_ast_node::condition_index));
+						auto body = compile_statement(node.get_child(grammar::while_ast_node::body_index), false);
+						scopes_.pop_back();
+						if (not condition || not body) { return nullptr; }
+
+						return [condition = std::move(condition), body = std::move(body), is_tail](frame_type& frame, result_type& result)
+						{
+							while (condition(frame)) { if (body(frame, result)) { return true; } }
+							if (is_tail) { result = {}; }
+							return false;
+						};
+					}
+
+					return compile_expression(node, is_tail);
+				}
+
+			public:
+				explicit compiler(const std::vector<identifier_type>& param_names)
+					: scopes_{1},
+					  num_params_{param_names.size()},
+					  num_slots_{param_names.size()},
+					  integer_slots_(param_names.size(), false)
+				{
+					for (slot_type i = 0; i < param_names.size(); ++i) { scopes_.front().emplace_back(param_names[i], i); }
+				}
+
+				[[nodiscard]] std::shared_ptr<const numeric_function> compile(const ast::ast_node& body)
+				{
+					auto statement = compile_statement(body, true);
+					if (not statement) { return nullptr; }
+					return std::make_shared<const numeric_function>(num_params_, num_slots_, std::move(statement));
+				}
+			};
+
+			slot_type num_params_;
+			slot_type num_slots_;
+			statement_type body_;
+
+		public:
+			numeric_function(const slot_type num_params, const slot_type num_slots, statement_type&& body)
+				: num_params_{num_params},
+				  num_slots_{num_slots},
+				  body_{std::move(body)} {}
+
+			[[nodiscard]] static std::shared_ptr<const numeric_function> compile(const ast::ast_node& body, const std::vector<identifier_type>& param_names)
+			{
+				// the interpreter does not add the parameter named `this`, and rejects the duplicate names
+				if (std::ranges::find(param_names, foundation::object_self_name::value) != param_names.end()) { return nullptr; }
+				for (auto it = param_names.begin(); it != param_names.end(); ++it) { if (std::ranges::find(std::next(it), param_names.end(), *it) != param_names.end()) { return nullptr; } }
+
+				return compiler{param_names}.compile(body);
+			}
+
+			[[nodiscard]] foundation::boxed_value invoke(const foundation::parameters_view_type params) const
+			{
+				gal_assert(params.size() == num_params_);
+
+				frame_type frame(num_slots_);
+				std::ranges::transform(params, frame.begin(), [](const auto& param) { return *static_cast<const double*>(param.get_const_raw()); });
+
+				result_type result{};
+				(void)body_(frame, result);
+
+				switch (result.kind)
+				{
+						using enum result_type::kind_type;
+					case number: { return const_var(result.number); }
+					case local: { return foundation::boxed_value{result.number}; }
+					case integer: { return const_var(static_cast<int>(result.number)); }
+					case integer_local: { return foundation::boxed_value{static_cast<int>(result.number)}; }
+					case boolean: { return const_var(result.boolean); }
+					case nothing:
+					default: { return void_var(); }
+				}
+			}
+		};
+
+		inline std::shared_ptr<const numeric_function> compile_numeric_function(const ast::ast_node& body, const std::vector<ast::ast_node::identifier_type>& param_names) { return numeric_function::compile(body, param_names); }
+
+		inline bool numeric_tier::is_numeric(const foundation::parameters_view_type params) noexcept { return std::ranges::all_of(params, [](const auto& param) { return param.type_info().bare_equal(typeid(double)); }); }
+
+		inline std::optional<foundation::boxed_value> numeric_tier::invoke(const ast::ast_node& body, const foundation::parameters_view_type params)
+		{
+			if (failed_.load(std::memory_order_acquire) || not is_numeric(params)) { return std::nullopt; }
+
+			auto function = function_.load(std::memory_order_acquire);
+			if (not function)
+			{
+				// the interpreter makes the calls until the function is compiled (maybe by another thread)
+				if (calls_.fetch_add(1, std::memory_order_relaxed) + 1 != compile_threshold) { return std::nullopt; }
+
+				function = compile_numeric_function(body, param_names_);
+				if (not function)
+				{
+					failed_.store(true, std::memory_order_release);
+					return std::nullopt;
+				}
+				function_.store(function, std::memory_order_release);
+			}
+
+			return function->invoke(params);
+		}
+	}
+
 	namespace exception
 	{
 		inline void eval_error::pretty_print_to(string_type& dest) const
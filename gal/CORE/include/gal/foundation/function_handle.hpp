@@ -0,0 +1,206 @@
+#pragma once
+
+#ifndef GAL_LANG_FOUNDATION_FUNCTION_HANDLE_HPP
+#define GAL_LANG_FOUNDATION_FUNCTION_HANDLE_HPP
+
+#include <gal/foundation/dispatcher.hpp>
+#include <array>
+#include <span>
+
+namespace gal::lang::foundation
+{
+	namespace function_handle_detail
+	{
+		/**
+		 * @brief Box an argument of the host, the references are boxed as references (no copy).
+		 */
+		template<typename T>
+		[[nodiscard]] boxed_value box_argument(T&& argument)
+		{
+			if constexpr (std::is_same_v<std::remove_cvref_t<T>, boxed_value>) { return argument; }
+			else if constexpr (std::is_lvalue_reference_v<T>) { return boxed_value{std::ref(argument)}; }
+			else { return boxed_value{std::forward<T>(argument)}; }
+		}
+
+		/**
+		 * @brief Whether the function can be called with the boxed arguments directly (without any conversion).
+		 */
+		template<typename... Params>
+		[[nodiscard]] bool is_directly_invokable(const function_proxy_base& function)
+		{
+			if (function.arity_size() == function_proxy_base::no_parameters_arity) { return true; }
+			if (function.arity_size() != static_cast<function_proxy_base::arity_size_type>(sizeof...(Params))) { return false; }
+
+			const std::array<gal_type_info, sizeof...(Params)> param_types{make_type_info<Params>()...};
+			const auto function_types = function.type_view() | std::views::drop(1);
+
+			return std::ranges::equal(
+					function_types,
+					param_types,
+					[](const gal_type_info& expected, const gal_type_info& type)
+					{
+						return expected.is_undefined() ||
+						       expected.bare_equal(boxed_value::class_type()) ||
+						       expected.bare_equal(type) ||
+						       (expected.bare_equal(types::number_type::class_type()) && type.is_arithmetic());
+					});
+		}
+	}
+
+	template<typename FunctionSignature>
+	class function_handle;
+
+	/**
+	 * @brief A callable handle of a (script) function, it resolves the overload once and then calls it directly.
+	 * The overload will be resolved again if the overload set changes.
+	 *
+	 * @note The handle is not thread-safe, copy it for each thread.
+	 */
+	template<typename Result, typename... Params>
+	class function_handle<Result(Params ...)>
+	{
+	public:
+		using function_signature_type = Result(Params ...);
+
+		// the arguments of the batch call, the references are passed as they are, others are copied for each call
+		template<typename Param>
+		using batch_input_type = std::conditional_t<std::is_lvalue_reference_v<Param>, std::remove_reference_t<Param>, const std::remove_cvref_t<Param>>;
+
+		static_assert(not std::is_reference_v<Result>, "The result of the function is a temporary, it cannot be returned by reference");
+
+	private:
+		std::reference_wrapper<dispatcher> dispatcher_;
+		dispatcher::function_id_type id_;
+
+		mutable std::size_t version_;
+		mutable std::shared_ptr<function_proxies_type> functions_;
+		// the only overload that can be called with the arguments, or null if it has to be dispatched
+		mutable const function_proxy_base* function_;
+
+		void resolve() const
+		{
+			// get the version first, if the overload set changes after this, it will be resolved again next time
+			version_ = id_->version.load(std::memory_order_acquire);
+			functions_ = dispatcher_.get().get_function(id_);
+
+			function_ = [this]() -> const function_proxy_base*
+			{
+				const function_proxy_base* candidate = nullptr;
+
+				for (const auto& function: *functions_)
+				{
+					// the guard may reject the arguments, let the dispatcher try the other overloads
+					if (const auto* dynamic_function = dynamic_cast<const dynamic_function_proxy_base*>(function.get());
+						dynamic_function && dynamic_function->has_guard()) { return nullptr; }
+
+					if (function_handle_detail::is_directly_invokable<Params...>(*function))
+					{
+						// ambiguous, let the dispatcher decide
+						if (candidate) { return nullptr; }
+						candidate = function.get();
+					}
+				}
+
+				return candidate;
+			}();
+		}
+
+		[[nodiscard]] static boxed_value invoke(
+				const function_proxies_type& functions,
+				const function_proxy_base* function,
+				const parameters_view_type arguments,
+				const dispatcher_state& state)
+		{
+			if (function) { return (*function)(arguments, state.convertor_state()); }
+			return dispatch(functions, arguments, state.convertor_state());
+		}
+
+		[[nodiscard]] static Result unbox(const boxed_value& result, const dispatcher_state& state)
+		{
+			if constexpr (std::is_same_v<Result, void>) { (void)result; }
+			else if constexpr (std::is_same_v<Result, boxed_value>) { return result; }
+			else
+			{
+				// the type matches, no conversion required
+				if (result.type_info().bare_equal(make_type_info<Result>())) { return boxed_cast<Result>(result); }
+				return boxed_cast<Result>(result, &state.convertor_state());
+			}
+		}
+
+		template<typename Output>
+		void do_call_batch(Output output, const std::size_t size, const std::span<batch_input_type<Params>>... inputs) const
+		{
+			if (((inputs.size() < size) || ...)) { throw std::out_of_range{std_format::format("Batch call of '{}' requires {} group(s) of arguments, but some input is shorter.", name(), size)}; }
+
+			if (id_->version.load(std::memory_order_acquire) != version_) { resolve(); }
+
+			// one function scope for the whole batch
+			const dispatcher_state state{dispatcher_.get()};
+			const scoped_function_scope function_scope{state};
+
+			// hold the overload set, the function may be re-resolved by the nested calls
+			const auto functions = functions_;
+			const auto* function = function_;
+
+			// one parameter buffer for the whole batch
+			std::array<boxed_value, sizeof...(Params)> arguments{};
+			for (std::size_t i = 0; i < size; ++i)
+			{
+				arguments = {function_handle_detail::box_argument(static_cast<Params>(inputs[i]))...};
+
+				if constexpr (std::is_same_v<Result, void>) { (void)invoke(*functions, function, parameters_view_type{arguments}, state); }
+				else { output[i] = unbox(invoke(*functions, function, parameters_view_type{arguments}, state), state); }
+
+				// the converted temporaries only live for one call, do not let them pile up
+				(void)state.convertor_state()->exchange_conversion_saves();
+			}
+		}
+
+	public:
+		function_handle(dispatcher& d, const dispatcher::function_id_type id)
+			: dispatcher_{d},
+			  id_{id},
+			  version_{0},
+			  function_{nullptr} { resolve(); }
+
+		[[nodiscard]] string_view_type name() const noexcept { return id_->name; }
+
+		/**
+		 * @throw exception::dispatch_error if no overload can be called with the arguments.
+		 * @throw exception::bad_boxed_cast if the result cannot be converted to Result.
+		 */
+		Result operator()(Params ... params) const
+		{
+			if (id_->version.load(std::memory_order_acquire) != version_) { resolve(); }
+
+			const std::array<boxed_value, sizeof...(Params)> arguments{function_handle_detail::box_argument(std::forward<Params>(params))...};
+
+			const dispatcher_state state{dispatcher_.get()};
+			const scoped_function_scope function_scope{state};
+
+			// hold the overload set, the function may be re-resolved by the nested calls
+			const auto functions = functions_;
+			return unbox(invoke(*functions, function_, parameters_view_type{arguments}, state), state);
+		}
+
+		/**
+		 * @brief Call the function once for each group of arguments (the i-th element of every input), the results are written into the output.
+		 * The function scope and the parameter buffer are shared by all the calls.
+		 *
+		 * @throw std::out_of_range if any input is shorter than the output.
+		 */
+		void call_batch(const std::span<Result> output, const std::span<batch_input_type<Params>>... inputs) const
+			requires(not std::is_same_v<Result, void>) { this->do_call_batch(output, output.size(), inputs...); }
+
+		/**
+		 * @brief Call the function once for each group of arguments (the i-th element of every input).
+		 * The function scope and the parameter buffer are shared by all the calls.
+		 *
+		 * @throw std::out_of_range if any input is shorter than the first one.
+		 */
+		void call_batch(const std::span<batch_input_type<Params>>... inputs) const
+			requires std::is_same_v<Result, void> && (sizeof...(Params) != 0) { this->do_call_batch(nullptr, std::get<0>(std::tie(inputs...)).size(), inputs...); }
+	};
+}
+
+#endif // GAL_LANG_FOUNDATION_FUNCTION_HANDLE_HPP
@@ -10,8 +10,11 @@
 #include <gal/foundation/name.hpp>
 #include <gal/tools/logger.hpp>
 #include <utils/algorithm.hpp>
+#include <utils/enum_utils.hpp>
 #include <memory>
+#include <optional>
 #include <ranges>
+#include <tuple>
 
 namespace gal::lang
 {
@@ -149,6 +152,43 @@ namespace gal::lang
 				}
 				else { return return_wrapper_detail::return_wrapper<Result>::wrapper(call.decltype(call)::template operator()<true>(std::index_sequence_for<Params...>{})); }
 			}
+
+			/**
+			 * @brief Used by function_proxy to perform type safe execution of a function,
+			 * each parameter is unboxed only once and held in a tuple until the function is called.
+			 * @note The caller checks the parameter types before, if an unboxing still fails (the conversion itself failed)
+			 * the function will not be called and the result is empty.
+			 * Any exception thrown by the function is passed up to the caller.
+			 */
+			template<typename Callable, typename Result, typename... Params>
+			std::optional<boxed_value> try_invoke(
+					Result (*)(Params ...),
+					const Callable& function,
+					const parameters_view_type params,
+					const convertor_manager_state& state)
+			{
+				// if boxed_cast returns a temporary, we hold the value instead of the reference
+				using arguments_type = std::tuple<decltype(boxed_cast<Params>(std::declval<const boxed_value&>(), &state))...>;
+
+				auto arguments = [&]<std::size_t... Index>(std::index_sequence<Index...>) -> std::optional<arguments_type>
+				{
+					// braced initialization, unboxed from left to right
+					try { return arguments_type{boxed_cast<Params>(params[Index], &state)...}; }
+					catch (const exception::bad_boxed_cast&) { return std::nullopt; }
+				}(std::index_sequence_for<Params...>{});
+
+				if (not arguments) { return std::nullopt; }
+
+				return [&]<std::size_t... Index>(std::index_sequence<Index...>) -> boxed_value
+				{
+					if constexpr (std::is_same_v<Result, void>)
+					{
+						function(std::get<Index>(std::move(*arguments))...);
+						return return_wrapper_detail::return_wrapper<void>::wrapper();
+					}
+					else { return return_wrapper_detail::return_wrapper<Result>::wrapper(function(std::get<Index>(std::move(*arguments))...)); }
+				}(std::index_sequence_for<Params...>{});
+			}
 		}
 
 		class parameter_type_mapper
@@ -300,6 +340,26 @@ namespace gal::lang
 			[[nodiscard]] constexpr auto view() const noexcept { return mapping_ | std::views::all; }
 		};
 
+		/**
+		 * @brief The effects of a function that the optimizer can rely on.
+		 *
+		 * @note The attributes are promises of the host, they are not checked.
+		 */
+		enum class function_attribute : std::uint8_t
+		{
+			none = 0,
+			// the result only depends on the arguments, and nothing (including the arguments) is modified
+			pure = 1 << 0,
+			// it never throws
+			no_throw = 1 << 1,
+			// the result is a new value, it does not refer to (a part of) the arguments or any other object
+			const_result = 1 << 2,
+			// it never calls a script function (including the functions passed to it)
+			no_script_callback = 1 << 3,
+		};
+
+		[[nodiscard]] constexpr function_attribute operator|(const function_attribute lhs, const function_attribute rhs) noexcept { return utils::set_enum_flag_ret(lhs, rhs); }
+
 		/**
 		 * @brief Pure virtual base class for all function_proxy implementations.
 		 * function_proxy are a type erasure of type safe C++ function calls.
@@ -331,6 +391,7 @@ namespace gal::lang
 			type_infos_type types_;
 			arity_size_type arity_{};
 			bool has_arithmetic_param_{};
+			function_attribute attributes_{function_attribute::none};
 
 			static bool is_all_convertible(const type_infos_view_type types, const parameters_view_type params, const convertor_manager_state& state) noexcept
 			{
@@ -354,6 +415,15 @@ namespace gal::lang
 		private:
 			[[nodiscard]] virtual boxed_value do_invoke(parameters_view_type params, const convertor_manager_state& state) const = 0;
 
+			/**
+			 * @note The params are matched before the call, so any exception thrown by the function is passed up to the caller.
+			 */
+			[[nodiscard]] virtual std::optional<boxed_value> do_try_invoke(const parameters_view_type params, const convertor_manager_state& state) const
+			{
+				if (not match(params, state)) { return std::nullopt; }
+				return do_invoke(params, state);
+			}
+
 		public:
 			[[nodiscard]] static bool is_convertible(const gal_type_info& type, const boxed_value& object, const convertor_manager_state& state) noexcept
 			{
@@ -425,6 +495,16 @@ namespace gal::lang
 							,
 							const std_source_location& location = std_source_location::current())) const { return this->operator()(parameters_view_type{params}, state GAL_LANG_RECODE_CALL_LOCATION_DEBUG_DO(, location)); }
 
+			/**
+			 * @brief Invoke the function if the params match it, otherwise the result is empty.
+			 * @note Unlike operator(), a mismatched arity or parameter will not throw, but any exception thrown by the function is passed up to the caller.
+			 */
+			[[nodiscard]] std::optional<boxed_value> try_invoke(const parameters_view_type params, const convertor_manager_state& state) const
+			{
+				if (arity_ < 0 || static_cast<decltype(params.size())>(arity_) == params.size()) { return do_try_invoke(params, state); }
+				return std::nullopt;
+			}
+
 			/**
 			 * @brief The number of arguments the function takes or -1(no_parameters_arity) if it is variadic.
 			 */
@@ -441,6 +521,13 @@ namespace gal::lang
 
 			[[nodiscard]] constexpr bool has_arithmetic_param() const noexcept { return has_arithmetic_param_; }
 
+			[[nodiscard]] constexpr function_attribute attributes() const noexcept { return attributes_; }
+
+			// all the attributes are set
+			[[nodiscard]] constexpr bool has_attribute(const function_attribute attribute) const noexcept { return (attributes_ | attribute) == attributes_; }
+
+			void add_attributes(const function_attribute attributes) noexcept { utils::set_enum_flag_set(attributes_, attributes); }
+
 			/**
 			 * @brief Return true if the function is a possible match to the passed in values.
 			 */
@@ -585,22 +672,32 @@ namespace gal::lang
 		private:
 			callable_type function_;
 
-			[[nodiscard]] boxed_value do_invoke(const parameters_view_type params, const convertor_manager_state& state) const override
+			[[nodiscard]] boxed_value invoke_matched(const parameters_view_type params, const convertor_manager_state& state, const bool needs_conversions) const
 			{
-				if (const auto [m, c] = do_match(params, state);
-					m)
+				if (needs_conversions)
 				{
-					if (c)
+					if constexpr (std::is_invocable_v<Callable, parameters_view_type>)
 					{
-						if constexpr (std::is_invocable_v<Callable, parameters_view_type>)
-						{
-							// note that the argument is a tmp view
-							return function_(parameters_view_type{mapper_.convert(params, state)});
-						}
-						else { return function_(mapper_.convert(params, state)); }
+						// note that the argument is a tmp view
+						return function_(parameters_view_type{mapper_.convert(params, state)});
 					}
-					return function_(params);
+					else { return function_(mapper_.convert(params, state)); }
 				}
+				return function_(params);
+			}
+
+			[[nodiscard]] std::optional<boxed_value> do_try_invoke(const parameters_view_type params, const convertor_manager_state& state) const override
+			{
+				// the guard is evaluated only once
+				if (const auto [m, c] = do_match(params, state);
+					m) { return invoke_matched(params, state, c); }
+				return std::nullopt;
+			}
+
+			[[nodiscard]] boxed_value do_invoke(const parameters_view_type params, const convertor_manager_state& state) const override
+			{
+				if (const auto [m, c] = do_match(params, state);
+					m) { return invoke_matched(params, state, c); }
 
 				auto message = std_format::format(
 						"Guard evaluation failed with '{}' params [",
@@ -792,6 +889,12 @@ namespace gal::lang
 
 			[[nodiscard]] boxed_value do_invoke(parameters_view_type params, const convertor_manager_state& state) const override { return function_proxy_detail::do_invoke(static_cast<function_signature_type*>(nullptr), function_, params, state); }
 
+			[[nodiscard]] std::optional<boxed_value> do_try_invoke(const parameters_view_type params, const convertor_manager_state& state) const override
+			{
+				if (not is_all_convertible(types_, params, state)) { return std::nullopt; }
+				return function_proxy_detail::try_invoke(static_cast<function_signature_type*>(nullptr), function_, params, state);
+			}
+
 		public:
 			explicit callable_function_proxy(
 					Callable&& function)
@@ -832,6 +935,12 @@ namespace gal::lang
 
 			[[nodiscard]] boxed_value do_invoke(parameters_view_type params, const convertor_manager_state& state) const override { return function_proxy_detail::do_invoke(static_cast<function_signature_type*>(nullptr), function_.get(), params, state); }
 
+			[[nodiscard]] std::optional<boxed_value> do_try_invoke(const parameters_view_type params, const convertor_manager_state& state) const override
+			{
+				if (not is_all_convertible(types_, params, state)) { return std::nullopt; }
+				return function_proxy_detail::try_invoke(static_cast<function_signature_type*>(nullptr), function_.get(), params, state);
+			}
+
 		public:
 			assignable_function_proxy(
 					callable_type function,
@@ -1039,19 +1148,7 @@ namespace gal::lang
 							return param;
 						});
 
-				try { return (*matching)(new_parameters, conversion); }
-				catch (const exception::bad_boxed_cast&)
-				{
-					// parameter failed to cast
-				}
-				catch (const exception::arity_error&)
-				{
-					// invalid num params
-				}
-				catch (const exception::guard_error&)
-				{
-					// guard failed to allow the function to execute
-				}
+				if (auto result = (*matching).try_invoke(parameters_view_type{new_parameters}, conversion)) { return std::move(*result); }
 
 				throw exception::dispatch_error{
 						params.to<parameters_type>(),
@@ -1110,18 +1207,10 @@ namespace gal::lang
 			{
 				for (const auto& [order, function]: ordered_functions)
 				{
-					try { if (order == i && (i == 0 || function.get().filter(parameters, state))) { return function.get()(parameters, state); } }
-					catch (const exception::bad_boxed_cast&)
-					{
-						// parameter failed to cast, try again
-					}
-					catch (const exception::arity_error&)
-					{
-						// invalid num params, try again
-					}
-					catch (const exception::guard_error&)
+					if (order == i && (i == 0 || function.get().filter(parameters, state)))
 					{
-						// guard failed to allow the function to execute, try again
+						if (auto result = function.get().try_invoke(parameters, state)) { return std::move(*result); }
+						// parameter failed to cast or guard failed, try again
 					}
 				}
 			}
@@ -11,182 +11,183 @@ namespace gal::lang::foundation
 {
 	struct operator_register
 	{
+		// the operators of a host type are not annotated by default, the attributes depend on how the type implements them
 		template<typename T, typename Name, typename Function>
-		static void register_operator(engine_module& m, Function&& function) { m.add_function(Name::value, lang::fun(std::forward<Function>(function))); }
+		static void register_operator(engine_module& m, Function&& function, const function_attribute attributes = function_attribute::none) { m.add_function(Name::value, lang::fun(std::forward<Function>(function)), attributes); }
 
 		template<
 			typename T,
 			typename Name = operator_assign_name,
 			typename Signature = decltype([](T& lhs, const T& rhs) -> T& { return lhs = rhs; })>
-		static void register_assign(engine_module& m, Signature&& s = {}) { register_operator<T, Name>(m, std::forward<Signature>(s)); }
+		static void register_assign(engine_module& m, Signature&& s = {}, const function_attribute attributes = function_attribute::none) { register_operator<T, Name>(m, std::forward<Signature>(s), attributes); }
 
 		template<
 			typename T,
 			typename Name = operator_assign_name,
 			typename Signature = decltype([](T& lhs, T&& rhs) -> T& { return lhs = std::forward<T>(rhs); })>
-		static void register_move_assign(engine_module& m, Signature&& s = {}) { register_operator<T, Name>(m, std::forward<Signature>(s)); }
+		static void register_move_assign(engine_module& m, Signature&& s = {}, const function_attribute attributes = function_attribute::none) { register_operator<T, Name>(m, std::forward<Signature>(s), attributes); }
 
 		template<
 			typename T,
 			typename Name = operator_equal_name,
 			typename Signature = decltype([](const T& lhs, const T& rhs) -> bool { return lhs == rhs; })>
-		static void register_equal(engine_module& m, Signature&& s = {}) { register_operator<T, Name>(m, std::forward<Signature>(s)); }
+		static void register_equal(engine_module& m, Signature&& s = {}, const function_attribute attributes = function_attribute::none) { register_operator<T, Name>(m, std::forward<Signature>(s), attributes); }
 
 		template<
 			typename T,
 			typename Name = operator_not_equal_name,
 			typename Signature = decltype([](const T& lhs, const T& rhs) -> bool { return lhs != rhs; })>
-		static void register_not_equal(engine_module& m, Signature&& s = {}) { register_operator<T, Name>(m, std::forward<Signature>(s)); }
+		static void register_not_equal(engine_module& m, Signature&& s = {}, const function_attribute attributes = function_attribute::none) { register_operator<T, Name>(m, std::forward<Signature>(s), attributes); }
 
 		template<
 			typename T,
 			typename Name = operator_less_than_name,
 			typename Signature = decltype([](const T& lhs, const T& rhs) -> bool { return lhs < rhs; })>
-		static void register_less_than(engine_module& m, Signature&& s = {}) { register_operator<T, Name>(m, std::forward<Signature>(s)); }
+		static void register_less_than(engine_module& m, Signature&& s = {}, const function_attribute attributes = function_attribute::none) { register_operator<T, Name>(m, std::forward<Signature>(s), attributes); }
 
 		template<
 			typename T,
 			typename Name = operator_less_equal_name,
 			typename Signature = decltype([](const T& lhs, const T& rhs) -> bool { return lhs <= rhs; })>
-		static void register_less_equal(engine_module& m, Signature&& s = {}) { register_operator<T, Name>(m, std::forward<Signature>(s)); }
+		static void register_less_equal(engine_module& m, Signature&& s = {}, const function_attribute attributes = function_attribute::none) { register_operator<T, Name>(m, std::forward<Signature>(s), attributes); }
 
 		template<
 			typename T,
 			typename Name = operator_greater_than_name,
 			typename Signature = decltype([](const T& lhs, const T& rhs) -> bool { return lhs > rhs; })>
-		static void register_greater_than(engine_module& m, Signature&& s = {}) { register_operator<T, Name>(m, std::forward<Signature>(s)); }
+		static void register_greater_than(engine_module& m, Signature&& s = {}, const function_attribute attributes = function_attribute::none) { register_operator<T, Name>(m, std::forward<Signature>(s), attributes); }
 
 		template<
 			typename T,
 			typename Name = operator_greater_equal_name,
 			typename Signature = decltype([](const T& lhs, const T& rhs) -> bool { return lhs >= rhs; })>
-		static void register_greater_equal(engine_module& m, Signature&& s = {}) { register_operator<T, Name>(m, std::forward<Signature>(s)); }
+		static void register_greater_equal(engine_module& m, Signature&& s = {}, const function_attribute attributes = function_attribute::none) { register_operator<T, Name>(m, std::forward<Signature>(s), attributes); }
 
 		template<
 			typename T,
 			typename Name = operator_plus_name,
 			typename Signature = decltype([](const T& lhs, const T& rhs) -> T { return lhs + rhs; })>
-		static void register_plus(engine_module& m, Signature&& s = {}) { register_operator<T, Name>(m, std::forward<Signature>(s)); }
+		static void register_plus(engine_module& m, Signature&& s = {}, const function_attribute attributes = function_attribute::none) { register_operator<T, Name>(m, std::forward<Signature>(s), attributes); }
 
 		template<
 			typename T,
 			typename Name = operator_minus_name,
 			typename Signature = decltype([](const T& lhs, const T& rhs) -> T { return lhs - rhs; })>
-		static void register_minus(engine_module& m, Signature&& s = {}) { register_operator<T, Name>(m, std::forward<Signature>(s)); }
+		static void register_minus(engine_module& m, Signature&& s = {}, const function_attribute attributes = function_attribute::none) { register_operator<T, Name>(m, std::forward<Signature>(s), attributes); }
 
 		template<
 			typename T,
 			typename Name = operator_multiply_name,
 			typename Signature = decltype([](const T& lhs, const T& rhs) -> T { return lhs * rhs; })>
-		static void register_multiply(engine_module& m, Signature&& s = {}) { register_operator<T, Name>(m, std::forward<Signature>(s)); }
+		static void register_multiply(engine_module& m, Signature&& s = {}, const function_attribute attributes = function_attribute::none) { register_operator<T, Name>(m, std::forward<Signature>(s), attributes); }
 
 		template<
 			typename T,
 			typename Name = operator_divide_name,
 			typename Signature = decltype([](const T& lhs, const T& rhs) -> T { return lhs / rhs; })>
-		static void register_divide(engine_module& m, Signature&& s = {}) { register_operator<T, Name>(m, std::forward<Signature>(s)); }
+		static void register_divide(engine_module& m, Signature&& s = {}, const function_attribute attributes = function_attribute::none) { register_operator<T, Name>(m, std::forward<Signature>(s), attributes); }
 
 		template<
 			typename T,
 			typename Name = operator_remainder_name,
 			typename Signature = decltype([](const T& lhs, const T& rhs) -> T { return lhs % rhs; })>
-		static void register_remainder(engine_module& m, Signature&& s = {}) { register_operator<T, Name>(m, std::forward<Signature>(s)); }
+		static void register_remainder(engine_module& m, Signature&& s = {}, const function_attribute attributes = function_attribute::none) { register_operator<T, Name>(m, std::forward<Signature>(s), attributes); }
 
 		template<
 			typename T,
 			typename Name = operator_plus_assign_name,
 			typename Signature = decltype([](T& lhs, const T& rhs) -> T& { return lhs += rhs; })>
-		static void register_plus_assign(engine_module& m, Signature&& s = {}) { register_operator<T, Name>(m, std::forward<Signature>(s)); }
+		static void register_plus_assign(engine_module& m, Signature&& s = {}, const function_attribute attributes = function_attribute::none) { register_operator<T, Name>(m, std::forward<Signature>(s), attributes); }
 
 		template<
 			typename T,
 			typename Name = operator_minus_assign_name,
 			typename Signature = decltype([](T& lhs, const T& rhs) -> T& { return lhs -= rhs; })>
-		static void register_minus_assign(engine_module& m, Signature&& s = {}) { register_operator<T, Name>(m, std::forward<Signature>(s)); }
+		static void register_minus_assign(engine_module& m, Signature&& s = {}, const function_attribute attributes = function_attribute::none) { register_operator<T, Name>(m, std::forward<Signature>(s), attributes); }
 
 		template<
 			typename T,
 			typename Name = operator_multiply_assign_name,
 			typename Signature = decltype([](T& lhs, const T& rhs) -> T& { return lhs *= rhs; })>
-		static void register_multiply_assign(engine_module& m, Signature&& s = {}) { register_operator<T, Name>(m, std::forward<Signature>(s)); }
+		static void register_multiply_assign(engine_module& m, Signature&& s = {}, const function_attribute attributes = function_attribute::none) { register_operator<T, Name>(m, std::forward<Signature>(s), attributes); }
 
 		template<
 			typename T,
 			typename Name = operator_divide_assign_name,
 			typename Signature = decltype([](T& lhs, const T& rhs) -> T& { return lhs /= rhs; })>
-		static void register_divide_assign(engine_module& m, Signature&& s = {}) { register_operator<T, Name>(m, std::forward<Signature>(s)); }
+		static void register_divide_assign(engine_module& m, Signature&& s = {}, const function_attribute attributes = function_attribute::none) { register_operator<T, Name>(m, std::forward<Signature>(s), attributes); }
 
 		template<
 			typename T,
 			typename Name = operator_remainder_assign_name,
 			typename Signature = decltype([](T& lhs, const T& rhs) -> T& { return lhs %= rhs; })>
-		static void register_remainder_assign(engine_module& m, Signature&& s = {}) { register_operator<T, Name>(m, std::forward<Signature>(s)); }
+		static void register_remainder_assign(engine_module& m, Signature&& s = {}, const function_attribute attributes = function_attribute::none) { register_operator<T, Name>(m, std::forward<Signature>(s), attributes); }
 
 		template<
 			typename T,
 			typename Name = operator_bitwise_shift_left_name,
 			typename Signature = decltype([](const T& lhs, const T& rhs) -> T { return lhs << rhs; })>
-		static void register_bitwise_shift_left(engine_module& m, Signature&& s = {}) { register_operator<T, Name>(m, std::forward<Signature>(s)); }
+		static void register_bitwise_shift_left(engine_module& m, Signature&& s = {}, const function_attribute attributes = function_attribute::none) { register_operator<T, Name>(m, std::forward<Signature>(s), attributes); }
 
 		template<
 			typename T,
 			typename Name = operator_bitwise_shift_right_name,
 			typename Signature = decltype([](const T& lhs, const T& rhs) -> T { return lhs >> rhs; })>
-		static void register_bitwise_shift_right(engine_module& m, Signature&& s = {}) { register_operator<T, Name>(m, std::forward<Signature>(s)); }
+		static void register_bitwise_shift_right(engine_module& m, Signature&& s = {}, const function_attribute attributes = function_attribute::none) { register_operator<T, Name>(m, std::forward<Signature>(s), attributes); }
 
 		template<
 			typename T,
 			typename Name = operator_bitwise_and_name,
 			typename Signature = decltype([](const T& lhs, const T& rhs) -> T { return lhs & rhs; })>
-		static void register_bitwise_and(engine_module& m, Signature&& s = {}) { register_operator<T, Name>(m, std::forward<Signature>(s)); }
+		static void register_bitwise_and(engine_module& m, Signature&& s = {}, const function_attribute attributes = function_attribute::none) { register_operator<T, Name>(m, std::forward<Signature>(s), attributes); }
 
 		template<
 			typename T,
 			typename Name = operator_bitwise_or_name,
 			typename Signature = decltype([](const T& lhs, const T& rhs) -> T { return lhs | rhs; })>
-		static void register_bitwise_or(engine_module& m, Signature&& s = {}) { register_operator<T, Name>(m, std::forward<Signature>(s)); }
+		static void register_bitwise_or(engine_module& m, Signature&& s = {}, const function_attribute attributes = function_attribute::none) { register_operator<T, Name>(m, std::forward<Signature>(s), attributes); }
 
 		template<
 			typename T,
 			typename Name = operator_bitwise_xor_name,
 			typename Signature = decltype([](const T& lhs, const T& rhs) -> T { return lhs ^ rhs; })>
-		static void register_bitwise_xor(engine_module& m, Signature&& s = {}) { register_operator<T, Name>(m, std::forward<Signature>(s)); }
+		static void register_bitwise_xor(engine_module& m, Signature&& s = {}, const function_attribute attributes = function_attribute::none) { register_operator<T, Name>(m, std::forward<Signature>(s), attributes); }
 
 		template<
 			typename T,
 			typename Name = operator_bitwise_shift_left_assign_name,
 			typename Signature = decltype([](T& lhs, const T& rhs) -> T& { return lhs <<= rhs; })>
-		static void register_bitwise_shift_left_assign(engine_module& m, Signature&& s = {}) { register_operator<T, Name>(m, std::forward<Signature>(s)); }
+		static void register_bitwise_shift_left_assign(engine_module& m, Signature&& s = {}, const function_attribute attributes = function_attribute::none) { register_operator<T, Name>(m, std::forward<Signature>(s), attributes); }
 
 		template<
 			typename T,
 			typename Name = operator_bitwise_shift_right_assign_name,
 			typename Signature = decltype([](T& lhs, const T& rhs) -> T& { return lhs >>= rhs; })>
-		static void register_bitwise_shift_right_assign(engine_module& m, Signature&& s = {}) { register_operator<T, Name>(m, std::forward<Signature>(s)); }
+		static void register_bitwise_shift_right_assign(engine_module& m, Signature&& s = {}, const function_attribute attributes = function_attribute::none) { register_operator<T, Name>(m, std::forward<Signature>(s), attributes); }
 
 		template<
 			typename T,
 			typename Name = operator_bitwise_and_assign_name,
 			typename Signature = decltype([](T& lhs, const T& rhs) -> T& { return lhs &= rhs; })>
-		static void register_bitwise_and_assign(engine_module& m, Signature&& s = {}) { register_operator<T, Name>(m, std::forward<Signature>(s)); }
+		static void register_bitwise_and_assign(engine_module& m, Signature&& s = {}, const function_attribute attributes = function_attribute::none) { register_operator<T, Name>(m, std::forward<Signature>(s), attributes); }
 
 		template<
 			typename T,
 			typename Name = operator_bitwise_or_assign_name,
 			typename Signature = decltype([](T& lhs, const T& rhs) -> T& { return lhs |= rhs; })>
-		static void register_bitwise_or_assign(engine_module& m, Signature&& s = {}) { register_operator<T, Name>(m, std::forward<Signature>(s)); }
+		static void register_bitwise_or_assign(engine_module& m, Signature&& s = {}, const function_attribute attributes = function_attribute::none) { register_operator<T, Name>(m, std::forward<Signature>(s), attributes); }
 
 		template<
 			typename T,
 			typename Name = operator_bitwise_xor_assign_name,
 			typename Signature = decltype([](T& lhs, const T& rhs) -> T& { return lhs ^= rhs; })>
-		static void register_bitwise_xor_assign(engine_module& m, Signature&& s = {}) { register_operator<T, Name>(m, std::forward<Signature>(s)); }
+		static void register_bitwise_xor_assign(engine_module& m, Signature&& s = {}, const function_attribute attributes = function_attribute::none) { register_operator<T, Name>(m, std::forward<Signature>(s), attributes); }
 
 		template<
 			typename T,
 			typename Name = operator_unary_not_name,
 			typename Signature = decltype([](const T& self) -> decltype(auto) { return !self; })>
-		static void register_unary_not(engine_module& m, Signature&& s = {}) { register_operator<T, Name>(m, std::forward<Signature>(s)); }
+		static void register_unary_not(engine_module& m, Signature&& s = {}, const function_attribute attributes = function_attribute::none) { register_operator<T, Name>(m, std::forward<Signature>(s), attributes); }
 
 		template<
 			typename T,
@@ -201,7 +202,7 @@ namespace gal::lang::foundation
 				}
 				else { return +self; }
 			})>
-		static void register_unary_plus(engine_module& m, Signature&& s = {}) { register_operator<T, Name>(m, std::forward<Signature>(s)); }
+		static void register_unary_plus(engine_module& m, Signature&& s = {}, const function_attribute attributes = function_attribute::none) { register_operator<T, Name>(m, std::forward<Signature>(s), attributes); }
 
 		template<
 			typename T,
@@ -215,13 +216,13 @@ namespace gal::lang::foundation
 				}
 				return -self;
 			})>
-		static void register_unary_minus(engine_module& m, Signature&& s = {}) { register_operator<T, Name>(m, std::forward<Signature>(s)); }
+		static void register_unary_minus(engine_module& m, Signature&& s = {}, const function_attribute attributes = function_attribute::none) { register_operator<T, Name>(m, std::forward<Signature>(s), attributes); }
 
 		template<
 			typename T,
 			typename Name = operator_unary_bitwise_complement_name,
 			typename Signature = decltype([](const T& self) { return ~self; })>
-		static void register_unary_bitwise_complement(engine_module& m, Signature&& s = {}) { register_operator<T, Name>(m, std::forward<Signature>(s)); }
+		static void register_unary_bitwise_complement(engine_module& m, Signature&& s = {}, const function_attribute attributes = function_attribute::none) { register_operator<T, Name>(m, std::forward<Signature>(s), attributes); }
 	};
 }// namespace gal::foundation
 
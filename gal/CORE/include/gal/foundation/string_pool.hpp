@@ -8,7 +8,8 @@
 
 namespace gal::lang::foundation
 {
-	using string_pool_type = utils::string_pool<string_type::value_type, false, string_type::traits_type>;
+	// interning, the same identifier from different files/modules only be stored once
+	using string_pool_type = utils::string_pool<string_type::value_type, false, string_type::traits_type, true>;
 }
 
 #endif // GAL_LANG_FOUNDATION_STRING_POOL_HPP
@@ -34,6 +34,21 @@ namespace gal::lang
 	template<typename Function, typename... PreBindParams>
 	[[nodiscard]] foundation::function_proxy_type fun(Function&& function, PreBindParams ... params) { return fun(std::bind_front(std::forward<Function>(function), std::forward<PreBindParams>(params)...)); }
 
+	/**
+	 * @brief Creates a new proxy_function object with the attributes (see foundation::function_attribute), they are kept when the function is added.
+	 *
+	 * @code
+	 * fun(&a_free_function, function_attribute::pure | function_attribute::no_throw)
+	 * @endcode
+	 */
+	template<typename Function>
+	[[nodiscard]] foundation::function_proxy_type fun(Function&& function, const foundation::function_attribute attributes)
+	{
+		auto f = fun(std::forward<Function>(function));
+		f->add_attributes(attributes);
+		return f;
+	}
+
 	template<typename ConstructorSignature>
 	[[nodiscard]] foundation::function_proxy_type ctor() { return foundation::function_register::register_constructor<ConstructorSignature>(); }
 
@@ -14,6 +14,15 @@ namespace gal::lang::grammar
 	 */
 	struct id_ast_node { };
 
+	/**
+	 * @brief An id_ast_node that is the last read of a local variable, the value is moved out of the variable instead of cloned.
+	 *
+	 * @note Generated by the optimizer, see id_ast_node.
+	 *
+	 * identifier -> boxed_value name
+	 */
+	struct last_use_id_ast_node { };
+
 	/**
 	 * @brief nothing, just a boxed_value.
 	 *
@@ -79,6 +88,15 @@ namespace gal::lang::grammar
 		constexpr static index_type rhs_index = 1;
 	};
 
+	/**
+	 * @brief An interpolated string, the result is the concatenation of all parts.
+	 *
+	 * children =>
+	 *
+	 * [0, n): constant_ast_node/other types return nodes -> string parts, non-string parts will be converted to string
+	 */
+	struct string_interpolation_ast_node { };
+
 	/**
 	 * @brief A function call.
 	 * @note see also arg_list_ast_node
@@ -96,6 +114,41 @@ namespace gal::lang::grammar
 		constexpr static index_type arg_list_index = 1;
 	};
 
+	/**
+	 * @brief A function call in tail position (return f(...)), it is made by the caller of the current function instead of recursing.
+	 *
+	 * @note Generated by the optimizer, see fun_call_ast_node.
+	 *
+	 * children =>
+	 *
+	 * 0: id_ast_node -> function (literal) name
+	 * 0: dot_access_ast_node -> object.function(arguments)
+	 *
+	 * 1: arg_list_node -> function parameters
+	 */
+	struct tail_call_ast_node
+	{
+		constexpr static index_type function_index = fun_call_ast_node::function_index;
+		constexpr static index_type arg_list_index = fun_call_ast_node::arg_list_index;
+	};
+
+	/**
+	 * @brief A function call whose callee is a small script function, the body of the function is evaluated directly as long as the name still refers to it.
+	 *
+	 * @note Generated by the optimizer, see fun_call_ast_node.
+	 *
+	 * children =>
+	 *
+	 * 0: id_ast_node -> function (literal) name
+	 *
+	 * 1: arg_list_node -> function parameters
+	 */
+	struct inline_call_ast_node
+	{
+		constexpr static index_type function_index = fun_call_ast_node::function_index;
+		constexpr static index_type arg_list_index = fun_call_ast_node::arg_list_index;
+	};
+
 	/**
 	 * @brief Basically a '[]' function call.
 	 *
@@ -391,6 +444,40 @@ namespace gal::lang::grammar
 		constexpr static index_type body_index = 2;
 	};
 
+	/**
+	 * @brief Represents a for loop over a range (for(i in range(...))), the index is counted directly.
+	 *
+	 * @note Generated by the optimizer, see ranged_for_ast_node.
+	 *
+	 * children =>
+	 *
+	 * 0: loop variable name
+	 *
+	 * 1: loop range variable name
+	 *
+	 * 2: block_ast_node -> loop body
+	 */
+	struct counted_for_ast_node
+	{
+		constexpr static index_type loop_variable_name_index = ranged_for_ast_node::loop_variable_name_index;
+		constexpr static index_type loop_range_name_index = ranged_for_ast_node::loop_range_name_index;
+		constexpr static index_type body_index = ranged_for_ast_node::body_index;
+	};
+
+	/**
+	 * @brief An expression whose value does not change in the loop, it is evaluated once each time the loop is entered (if the loop allows it).
+	 *
+	 * @note Generated by the optimizer, see while_ast_node/ranged_for_ast_node/counted_for_ast_node.
+	 *
+	 * children =>
+	 *
+	 * 0: the invariant expression
+	 */
+	struct loop_invariant_ast_node
+	{
+		constexpr static index_type expression_index = 0;
+	};
+
 	/**
 	 * @brief Represents a return statement.
 	 *
@@ -446,6 +533,24 @@ namespace gal::lang::grammar
 		constexpr static index_type match_value_index = 0;
 	};
 
+	/**
+	 * @brief Represents a matching branch statement whose case values are all integral constants or all string constants, the case is found through a jump table.
+	 *
+	 * @note Generated by the optimizer, see match_ast_node.
+	 *
+	 * children =>
+	 *
+	 * 0: match value
+	 *
+	 * 1~n: match_case_ast_node (0~n)
+	 *
+	 * 1~n: match_default_ast_node (0~1)
+	 */
+	struct constant_match_ast_node
+	{
+		constexpr static index_type match_value_index = match_ast_node::match_value_index;
+	};
+
 	/**
 	 * @brief Represents a logical AND statement.
 	 *
@@ -0,0 +1,74 @@
+#pragma once
+
+#ifndef GAL_LANG_PLUGIN_BINARY_MODULE_POSIX_HPP
+	#define GAL_LANG_PLUGIN_BINARY_MODULE_POSIX_HPP
+
+#ifndef GAL_LANG_POSIX
+#error "This file should not be used before macro GAL_LANG_POSIX is defined"
+#endif
+
+#include <dlfcn.h>
+
+#include <gal/foundation/dispatcher.hpp>
+
+namespace gal::lang::plugin
+{
+	struct binary_module
+	{
+	private:
+		static std::string get_error_message()
+		{
+			if (const auto* error = dlerror()) { return error; }
+			return "Unknown Error";
+		}
+
+	public:
+		struct dynamic_load_module
+		{
+		private:
+			struct module_deleter
+			{
+				auto operator()(void* m) const { return dlclose(m); }
+			};
+
+		public:
+			std::unique_ptr<void, module_deleter> handle;
+
+			explicit dynamic_load_module(const std::string_view filename)
+				: handle{dlopen(std::string{filename}.c_str(), module_load_mode)} { if (not handle) { throw exception::load_module_error{get_error_message()}; } }
+		};
+
+		template<typename T>
+			requires std::is_pointer_v<T>
+		struct dynamic_load_symbol
+		{
+			T symbol;
+
+			explicit dynamic_load_symbol(const dynamic_load_module& m, const std::string_view s)
+				: symbol{
+						  [&]
+						  {
+							  // clear the old error first, a null symbol is not necessarily an error
+							  (void)dlerror();
+							  auto* address = dlsym(m.handle.get(), std::string{s}.c_str());
+							  if (const auto* error = dlerror()) { throw exception::load_module_error{error}; }
+							  return reinterpret_cast<T>(address);
+						  }()} { if (not symbol) { throw exception::load_module_error{std::string{"Symbol '"}.append(s).append("' is null")}; } }
+		};
+
+		inline static std::string module_load_function_prefix = "create_module_";
+		// resolve all symbols when loading (instead of the first call), and do not make them available to other modules
+		inline static int module_load_mode = RTLD_NOW | RTLD_LOCAL;
+
+		dynamic_load_module dlm;
+		dynamic_load_symbol<foundation::engine_module_maker> function;
+		foundation::engine_module_type module_ptr;
+
+		binary_module(const std::string_view module_name, const std::string_view filename)
+			: dlm{filename},
+			  function{dlm, std::string{module_load_function_prefix}.append(module_name)},
+			  module_ptr{function.symbol()} { }
+	};
+}
+
+#endif // GAL_LANG_PLUGIN_BINARY_MODULE_POSIX_HPP
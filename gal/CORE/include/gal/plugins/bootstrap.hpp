@@ -4,10 +4,28 @@
 #define GAL_LANG_PLUGIN_BOOTSTRAP_HPP
 
 #include <gal/types/number_type.hpp>
+#include <gal/types/span_view_type.hpp>
 #include <gal/foundation/operator_register.hpp>
 
 namespace gal::lang::plugin
 {
+	/**
+	 * @brief The attributes of the builtin functions (see foundation::function_attribute).
+	 */
+	namespace builtin_attribute
+	{
+		using enum foundation::function_attribute;
+
+		// reads the arguments, the result may refer to them, e.g. container[index]
+		constexpr auto accessor = pure | no_script_callback;
+		// computes a new value from the arguments, e.g. number + number
+		constexpr auto operation = pure | const_result | no_script_callback;
+		// computes a new value from the arguments and never throws, e.g. container.size()
+		constexpr auto query = operation | no_throw;
+		// modifies the arguments, e.g. container.push_back(value)
+		constexpr auto mutation = no_script_callback;
+	}
+
 	template<typename T>
 		requires std::is_array_v<T>
 	void register_array_type(const foundation::string_view_type name, foundation::engine_module& m)
@@ -30,7 +48,8 @@ namespace gal::lang::plugin
 										index)};
 					}
 					return arr[index];
-				}));
+				}),
+				builtin_attribute::accessor);
 
 		m.add_function(
 				foundation::container_subscript_interface_name::value,
@@ -46,30 +65,92 @@ namespace gal::lang::plugin
 										index)};
 					}
 					return arr[index];
-				}));
+				}),
+				builtin_attribute::accessor);
 
 		m.add_function(
 				foundation::container_size_interface_name::value,
-				lang::fun([](const auto&) { return std::extent_v<T>; }));
+				lang::fun([](const auto&) { return std::extent_v<T>; }),
+				builtin_attribute::query);
 
 		// todo: maybe more interface?
 	}
 
+	/**
+	 * @brief Register a span_view of T, the host can pass its contiguous sequence to the script without copying (or boxing) the elements.
+	 *
+	 * @code
+	 * register_span_view_type<const float>("float_span", m);
+	 * engine.add_global("samples", const_var(types::span_view_type<const float>{samples}));
+	 * @endcode
+	 */
+	template<typename T>
+	void register_span_view_type(const foundation::string_view_type name, foundation::engine_module& m)
+	{
+		using span_type = types::span_view_type<T>;
+		using view_type = typename span_type::view_type;
+
+		m.add_type_info(name, span_type::class_type());
+
+		// span[index]
+		m.add_function(
+				foundation::container_subscript_interface_name::value,
+				lang::fun(&span_type::get),
+				builtin_attribute::accessor);
+
+		// span.size()
+		m.add_function(
+				foundation::container_size_interface_name::value,
+				lang::fun(&span_type::size),
+				builtin_attribute::query);
+
+		// span.empty()
+		m.add_function(
+				foundation::container_empty_interface_name::value,
+				lang::fun(&span_type::empty),
+				builtin_attribute::query);
+
+		// span.view()
+		m.add_function(
+				foundation::container_view_interface_name::value,
+				lang::fun(&span_type::view),
+				builtin_attribute::accessor);
+
+		// view.empty()
+		m.add_function(
+				foundation::container_view_empty_interface_name::value,
+				lang::fun(&view_type::empty),
+				builtin_attribute::query);
+
+		// view.get()
+		m.add_function(
+				foundation::container_view_star_interface_name::value,
+				lang::fun(&view_type::get),
+				builtin_attribute::accessor);
+
+		// view.next()
+		m.add_function(
+				foundation::container_view_advance_interface_name::value,
+				lang::fun(&view_type::advance),
+				builtin_attribute::mutation);
+	}
+
 	/**
 	 * @brief Add all comparison operators for the templated type.
 	 * Used during bootstrap, also available to users.
 	 *
 	 * @tparam T Type to create comparison operators for.
+	 * @param attributes The attributes of the operators (see foundation::function_attribute).
 	 */
 	template<typename T>
-	void register_comparison(foundation::engine_module& m)
+	void register_comparison(foundation::engine_module& m, const foundation::function_attribute attributes = foundation::function_attribute::none)
 	{
-		foundation::operator_register::register_equal<T>(m);
-		foundation::operator_register::register_not_equal<T>(m);
-		foundation::operator_register::register_less_than<T>(m);
-		foundation::operator_register::register_less_equal<T>(m);
-		foundation::operator_register::register_greater_than<T>(m);
-		foundation::operator_register::register_greater_equal<T>(m);
+		foundation::operator_register::register_equal<T>(m, {}, attributes);
+		foundation::operator_register::register_not_equal<T>(m, {}, attributes);
+		foundation::operator_register::register_less_than<T>(m, {}, attributes);
+		foundation::operator_register::register_less_equal<T>(m, {}, attributes);
+		foundation::operator_register::register_greater_than<T>(m, {}, attributes);
+		foundation::operator_register::register_greater_equal<T>(m, {}, attributes);
 	}
 
 	/**
@@ -95,7 +176,7 @@ namespace gal::lang::plugin
 			m.add_type_info(name, foundation::make_type_info<T>());
 
 			m.add_function(name, default_ctor<T>());
-			m.add_function(name, lang::fun([](const types::number_type& num) { return num.as<T>(); }));
+			m.add_function(name, lang::fun([](const types::number_type& num) { return num.as<T>(); }), builtin_attribute::operation);
 			{
 				foundation::string_type n{foundation::number_cast_interface_prefix::value};
 				n.reserve(n.size() + name.size());
@@ -112,7 +193,8 @@ namespace gal::lang::plugin
 										return t;
 									}
 									else { throw std::runtime_error{"Parsing given type is not supported yet"}; }
-								}));
+								}),
+						builtin_attribute::operation);
 			}
 			{
 				foundation::string_type n{foundation::number_cast_interface_prefix::value};
@@ -120,7 +202,8 @@ namespace gal::lang::plugin
 				n.append(name);
 				m.add_function(
 						std::move(n),
-						lang::fun([](const T t) { return t; }));
+						lang::fun([](const T t) { return t; }),
+						builtin_attribute::operation);
 			}
 		}
 
@@ -133,97 +216,128 @@ namespace gal::lang::plugin
 
 			m.add_function(
 					foundation::operator_assign_name::value,
-					fun(&number_type::operator_assign));
+					fun(&number_type::operator_assign),
+					builtin_attribute::mutation);
 			m.add_function(
 					foundation::operator_equal_name::value,
-					fun(&number_type::operator_equal));
+					fun(&number_type::operator_equal),
+					builtin_attribute::operation);
 			m.add_function(
 					foundation::operator_not_equal_name::value,
-					fun(&number_type::operator_not_equal));
+					fun(&number_type::operator_not_equal),
+					builtin_attribute::operation);
 			m.add_function(
 					foundation::operator_less_than_name::value,
-					fun(&number_type::operator_less_than));
+					fun(&number_type::operator_less_than),
+					builtin_attribute::operation);
 			m.add_function(
 					foundation::operator_less_equal_name::value,
-					fun(&number_type::operator_less_equal));
+					fun(&number_type::operator_less_equal),
+					builtin_attribute::operation);
 			m.add_function(
 					foundation::operator_greater_than_name::value,
-					fun(&number_type::operator_greater_than));
+					fun(&number_type::operator_greater_than),
+					builtin_attribute::operation);
 			m.add_function(
 					foundation::operator_greater_equal_name::value,
-					fun(&number_type::operator_greater_equal));
+					fun(&number_type::operator_greater_equal),
+					builtin_attribute::operation);
 			m.add_function(
 					foundation::operator_plus_name::value,
-					fun(&number_type::operator_plus));
+					fun(&number_type::operator_plus),
+					builtin_attribute::operation);
 			m.add_function(
 					foundation::operator_minus_name::value,
-					fun(&number_type::operator_minus));
+					fun(&number_type::operator_minus),
+					builtin_attribute::operation);
 			m.add_function(
 					foundation::operator_multiply_name::value,
-					fun(&number_type::operator_multiply));
+					fun(&number_type::operator_multiply),
+					builtin_attribute::operation);
 			m.add_function(
 					foundation::operator_divide_name::value,
-					fun(&number_type::operator_divide));
+					fun(&number_type::operator_divide),
+					builtin_attribute::operation);
 			m.add_function(
 					foundation::operator_remainder_name::value,
-					fun(&number_type::operator_remainder));
+					fun(&number_type::operator_remainder),
+					builtin_attribute::operation);
 			m.add_function(
 					foundation::operator_plus_assign_name::value,
-					fun(&number_type::operator_plus_assign));
+					fun(&number_type::operator_plus_assign),
+					builtin_attribute::mutation);
 			m.add_function(
 					foundation::operator_minus_assign_name::value,
-					fun(&number_type::operator_minus_assign));
+					fun(&number_type::operator_minus_assign),
+					builtin_attribute::mutation);
 			m.add_function(
 					foundation::operator_multiply_assign_name::value,
-					fun(&number_type::operator_multiply_assign));
+					fun(&number_type::operator_multiply_assign),
+					builtin_attribute::mutation);
 			m.add_function(
 					foundation::operator_divide_assign_name::value,
-					fun(&number_type::operator_divide_assign));
+					fun(&number_type::operator_divide_assign),
+					builtin_attribute::mutation);
 			m.add_function(
 					foundation::operator_remainder_assign_name::value,
-					fun(&number_type::operator_remainder_assign));
+					fun(&number_type::operator_remainder_assign),
+					builtin_attribute::mutation);
 			m.add_function(
 					foundation::operator_bitwise_shift_left_name::value,
-					fun(&number_type::operator_bitwise_shift_left));
+					fun(&number_type::operator_bitwise_shift_left),
+					builtin_attribute::operation);
 			m.add_function(
 					foundation::operator_bitwise_shift_right_name::value,
-					fun(&number_type::operator_bitwise_shift_right));
+					fun(&number_type::operator_bitwise_shift_right),
+					builtin_attribute::operation);
 			m.add_function(
 					foundation::operator_bitwise_and_name::value,
-					fun(&number_type::operator_bitwise_and));
+					fun(&number_type::operator_bitwise_and),
+					builtin_attribute::operation);
 			m.add_function(
 					foundation::operator_bitwise_or_name::value,
-					fun(&number_type::operator_bitwise_or));
+					fun(&number_type::operator_bitwise_or),
+					builtin_attribute::operation);
 			m.add_function(
 					foundation::operator_bitwise_xor_name::value,
-					fun(&number_type::operator_bitwise_xor));
+					fun(&number_type::operator_bitwise_xor),
+					builtin_attribute::operation);
 			m.add_function(
 					foundation::operator_bitwise_shift_left_assign_name::value,
-					fun(&number_type::operator_bitwise_shift_left_assign));
+					fun(&number_type::operator_bitwise_shift_left_assign),
+					builtin_attribute::mutation);
 			m.add_function(
 					foundation::operator_bitwise_shift_right_assign_name::value,
-					fun(&number_type::operator_bitwise_shift_right_assign));
+					fun(&number_type::operator_bitwise_shift_right_assign),
+					builtin_attribute::mutation);
 			m.add_function(
 					foundation::operator_bitwise_and_assign_name::value,
-					fun(&number_type::operator_bitwise_and_assign));
+					fun(&number_type::operator_bitwise_and_assign),
+					builtin_attribute::mutation);
 			m.add_function(
 					foundation::operator_bitwise_or_assign_name::value,
-					fun(&number_type::operator_bitwise_or_assign));
+					fun(&number_type::operator_bitwise_or_assign),
+					builtin_attribute::mutation);
 			m.add_function(
 					foundation::operator_bitwise_xor_assign_name::value,
-					fun(&number_type::operator_bitwise_xor_assign));
+					fun(&number_type::operator_bitwise_xor_assign),
+					builtin_attribute::mutation);
 			m.add_function(
 					foundation::operator_unary_not_name::value,
-					fun(&number_type::operator_unary_not));
+					fun(&number_type::operator_unary_not),
+					builtin_attribute::operation);
 			m.add_function(
 					foundation::operator_unary_plus_name::value,
-					fun(&number_type::operator_unary_plus));
+					fun(&number_type::operator_unary_plus),
+					builtin_attribute::operation);
 			m.add_function(
 					foundation::operator_unary_minus_name::value,
-					fun(&number_type::operator_unary_minus));
+					fun(&number_type::operator_unary_minus),
+					builtin_attribute::operation);
 			m.add_function(
 					foundation::operator_unary_bitwise_complement_name::value,
-					fun(&number_type::operator_unary_bitwise_complement));
+					fun(&number_type::operator_unary_bitwise_complement),
+					builtin_attribute::operation);
 		}
 
 	public:
@@ -41,6 +41,8 @@ namespace gal::lang::plugin
 		static void register_assignable_container(const foundation::string_view_type name, foundation::engine_module& m)
 		{
 			m.add_function(name, copy_ctor<ContainerType>());
+			// var x = y => y.clone()
+			m.add_function(foundation::object_clone_interface_name::value, copy_ctor<ContainerType>(), builtin_attribute::operation);
 			foundation::operator_register::register_assign<ContainerType>(m);
 		}
 
@@ -65,25 +67,30 @@ namespace gal::lang::plugin
 				// container.view()
 				m.add_function(
 						foundation::container_view_interface_name::value,
-						lang::fun(static_cast<view_type (container_type::*)() noexcept>(&container_type::view)));
+						lang::fun(static_cast<view_type (container_type::*)() noexcept>(&container_type::view)),
+						builtin_attribute::accessor);
 
 				// view.empty()
 				m.add_function(
 						foundation::container_view_empty_interface_name::value,
-						lang::fun(&view_type::empty));
+						lang::fun(&view_type::empty),
+						builtin_attribute::query);
 
 				// view.get()
 				m.add_function(
 						foundation::container_view_star_interface_name::value,
-						lang::fun(static_cast<foundation::boxed_value (view_type::*)() noexcept>(&view_type::get)));
+						lang::fun(static_cast<foundation::boxed_value (view_type::*)() noexcept>(&view_type::get)),
+						builtin_attribute::accessor);
 				m.add_function(
 						foundation::container_view_star_interface_name::value,
-						lang::fun(static_cast<foundation::boxed_value (view_type::*)() const noexcept>(&view_type::get)));
+						lang::fun(static_cast<foundation::boxed_value (view_type::*)() const noexcept>(&view_type::get)),
+						builtin_attribute::accessor);
 
 				// view.next()
 				m.add_function(
 						foundation::container_view_advance_interface_name::value,
-						lang::fun(&view_type::advance));
+						lang::fun(&view_type::advance),
+						builtin_attribute::mutation);
 			}
 			else {}
 
@@ -92,12 +99,14 @@ namespace gal::lang::plugin
 				// container.view()
 				m.add_function(
 						foundation::container_view_interface_name::value,
-						lang::fun(static_cast<const_view_type (container_type::*)() const noexcept>(&container_type::view)));
+						lang::fun(static_cast<const_view_type (container_type::*)() const noexcept>(&container_type::view)),
+						builtin_attribute::accessor);
 
 				// view.empty()
 				m.add_function(
 						foundation::container_view_empty_interface_name::value,
-						lang::fun(&const_view_type::empty));
+						lang::fun(&const_view_type::empty),
+						builtin_attribute::query);
 
 				static_assert(const_view_type::is_const_container);
 				// view.get()
@@ -106,12 +115,14 @@ namespace gal::lang::plugin
 				// 		lang::fun(&const_view_type::get));
 				m.add_function(
 						foundation::container_view_star_interface_name::value,
-						lang::fun(static_cast<foundation::boxed_value (const_view_type::*)() const noexcept>(&const_view_type::get)));
+						lang::fun(static_cast<foundation::boxed_value (const_view_type::*)() const noexcept>(&const_view_type::get)),
+						builtin_attribute::accessor);
 
 				// view.next()
 				m.add_function(
 						foundation::container_view_advance_interface_name::value,
-						lang::fun(&const_view_type::advance));
+						lang::fun(&const_view_type::advance),
+						builtin_attribute::mutation);
 			}
 			else {}
 		}
@@ -124,9 +135,9 @@ namespace gal::lang::plugin
 			m.add_function(foundation::boolean_type_name::value, copy_ctor<bool>());
 
 			foundation::operator_register::register_assign<bool>(m);
-			foundation::operator_register::register_equal<bool>(m);
-			foundation::operator_register::register_not_equal<bool>(m);
-			foundation::operator_register::register_unary_not<bool>(m);
+			foundation::operator_register::register_equal<bool>(m, {}, builtin_attribute::query);
+			foundation::operator_register::register_not_equal<bool>(m, {}, builtin_attribute::query);
+			foundation::operator_register::register_unary_not<bool>(m, {}, builtin_attribute::query);
 			m.add_function(
 					foundation::operator_to_string_name::value,
 					fun([](const bool b) -> decltype(auto)
@@ -134,7 +145,8 @@ namespace gal::lang::plugin
 						static types::string_type true_name{foundation::string_view_type{foundation::keyword_true_name::value}};
 						static types::string_type false_name{foundation::string_view_type{foundation::keyword_false_name::value}};
 						return b ? true_name : false_name;
-					}));
+					}),
+					builtin_attribute::accessor);
 		}
 
 		static void register_range_type(foundation::engine_module& m)
@@ -189,65 +201,80 @@ namespace gal::lang::plugin
 			// list[index]
 			m.add_function(
 					foundation::container_subscript_interface_name::value,
-					fun(static_cast<types::list_type::reference (types::list_type::*)(types::list_type::difference_type) noexcept>(&types::list_type::get)));
+					fun(static_cast<types::list_type::reference (types::list_type::*)(types::list_type::difference_type) noexcept>(&types::list_type::get)),
+					builtin_attribute::accessor);
 			m.add_function(
 					foundation::container_subscript_interface_name::value,
-					fun(static_cast<types::list_type::const_reference (types::list_type::*)(types::list_type::difference_type) const noexcept>(&types::list_type::get)));
+					fun(static_cast<types::list_type::const_reference (types::list_type::*)(types::list_type::difference_type) const noexcept>(&types::list_type::get)),
+					builtin_attribute::accessor);
 
 			// list.size()
 			m.add_function(
 					foundation::container_size_interface_name::value,
-					fun(&types::list_type::size));
+					fun(&types::list_type::size),
+					builtin_attribute::query);
 
 			// list.empty()
 			m.add_function(
 					foundation::container_empty_interface_name::value,
-					fun(&types::list_type::empty));
+					fun(&types::list_type::empty),
+					builtin_attribute::query);
 
 			// list.clear()
 			m.add_function(
 					foundation::container_clear_interface_name::value,
-					fun(&types::list_type::clear));
+					fun(&types::list_type::clear),
+					builtin_attribute::mutation);
 
 			// list.front()
 			m.add_function(
 					foundation::container_front_interface_name::value,
-					fun(static_cast<types::list_type::reference (types::list_type::*)() noexcept>(&types::list_type::front)));
+					fun(static_cast<types::list_type::reference (types::list_type::*)() noexcept>(&types::list_type::front)),
+					builtin_attribute::accessor);
 			m.add_function(
 					foundation::container_front_interface_name::value,
-					fun(static_cast<types::list_type::const_reference (types::list_type::*)() const noexcept>(&types::list_type::front)));
+					fun(static_cast<types::list_type::const_reference (types::list_type::*)() const noexcept>(&types::list_type::front)),
+					builtin_attribute::accessor);
 
 			// list.back()
 			m.add_function(
 					foundation::container_back_interface_name::value,
-					fun(static_cast<types::list_type::reference (types::list_type::*)() noexcept>(&types::list_type::back)));
+					fun(static_cast<types::list_type::reference (types::list_type::*)() noexcept>(&types::list_type::back)),
+					builtin_attribute::accessor);
 			m.add_function(
 					foundation::container_back_interface_name::value,
-					fun(static_cast<types::list_type::const_reference (types::list_type::*)() const noexcept>(&types::list_type::back)));
+					fun(static_cast<types::list_type::const_reference (types::list_type::*)() const noexcept>(&types::list_type::back)),
+					builtin_attribute::accessor);
 
 			// list.insert_at(index, value)/list.erase_at(index)
 			m.add_function(
 					foundation::container_insert_interface_name::value,
-					fun(&types::list_type::insert_at));
+					fun(&types::list_type::insert_at),
+					builtin_attribute::mutation);
 			m.add_function(
 					foundation::container_erase_interface_name::value,
-					fun(&types::list_type::erase_at));
+					fun(&types::list_type::erase_at),
+					builtin_attribute::mutation);
 
 			// list.push_back(value)/list.pop_back()
 			m.add_function(
 					foundation::container_push_back_interface_name::value,
-					fun(&types::list_type::push_back));
+					fun(&types::list_type::push_back),
+					builtin_attribute::mutation);
 			m.add_function(
 					foundation::container_pop_back_interface_name::value,
-					fun(&types::list_type::pop_back));
+					fun(&types::list_type::pop_back),
+					builtin_attribute::mutation);
 
 			// list.push_front()/list.pop_front()
 			m.add_function(
 					foundation::container_push_front_interface_name::value,
-					fun(&types::list_type::push_front));
+					fun(&types::list_type::push_front),
+					builtin_attribute::mutation);
 			m.add_function(
 					foundation::container_pop_front_interface_name::value,
-					fun(&types::list_type::pop_front));
+					fun(&types::list_type::pop_front),
+					builtin_attribute::mutation);
 
 			// todo: extra interface
 		}
@@ -270,8 +297,8 @@ namespace gal::lang::plugin
 			// register_movable_container<pair_type>(pair_name, m);
 			m.add_function(pair_name, move_ctor<pair_type>());
 			m.add_function(pair_name, ctor<pair_type(const pair_type::first_type&, const pair_type::second_type&)>());
-			m.add_function(foundation::pair_first_interface_name::value, fun(&pair_type::first));
-			m.add_function(foundation::pair_second_interface_name::value, fun(&pair_type::second));
+			m.add_function(foundation::pair_first_interface_name::value, fun(&pair_type::first), builtin_attribute::accessor);
+			m.add_function(foundation::pair_second_interface_name::value, fun(&pair_type::second), builtin_attribute::accessor);
 
 			// operator+/operator+=
 			// foundation::operator_register::register_plus<types::dict_type>(m);
@@ -281,32 +308,39 @@ namespace gal::lang::plugin
 			register_view_type<types::dict_type>(m);
 
 			// dict[key]
+			// inserts the key if it does not exist
 			m.add_function(
 					foundation::container_subscript_interface_name::value,
-					fun(static_cast<types::dict_type::mapped_reference (types::dict_type::*)(types::dict_type::key_const_reference)>(&types::dict_type::get)));
+					fun(static_cast<types::dict_type::mapped_reference (types::dict_type::*)(types::dict_type::key_const_reference)>(&types::dict_type::get)),
+					builtin_attribute::mutation);
 			m.add_function(
 					foundation::container_subscript_interface_name::value,
-					fun(static_cast<types::dict_type::mapped_const_reference (types::dict_type::*)(types::dict_type::key_const_reference) const>(&types::dict_type::get)));
+					fun(static_cast<types::dict_type::mapped_const_reference (types::dict_type::*)(types::dict_type::key_const_reference) const>(&types::dict_type::get)),
+					builtin_attribute::accessor);
 
 			// dict.size()
 			m.add_function(
 					foundation::container_size_interface_name::value,
-					fun(&types::dict_type::size));
+					fun(&types::dict_type::size),
+					builtin_attribute::query);
 
 			// dict.empty()
 			m.add_function(
 					foundation::container_empty_interface_name::value,
-					fun(&types::dict_type::empty));
+					fun(&types::dict_type::empty),
+					builtin_attribute::query);
 
 			// dict.clear()
 			m.add_function(
 					foundation::container_clear_interface_name::value,
-					fun(&types::dict_type::clear));
+					fun(&types::dict_type::clear),
+					builtin_attribute::mutation);
 
 			// dict.erase_at(key)
 			m.add_function(
 					foundation::container_erase_interface_name::value,
-					fun(&types::dict_type::erase_at));
+					fun(&types::dict_type::erase_at),
+					builtin_attribute::mutation);
 
 			// todo: extra interface
 		}
@@ -346,20 +380,22 @@ namespace gal::lang::plugin
 			register_movable_container<types::string_type>(foundation::string_type_name::value, m);
 
 			// operator+/operator+=
-			foundation::operator_register::register_plus<types::string_type>(m);
+			foundation::operator_register::register_plus<types::string_type>(m, {}, builtin_attribute::operation);
 			foundation::operator_register::register_plus<types::string_type>(
 					m,
-					[](const types::string_type& string, const types::char_type other) -> decltype(auto) { return string + other; });
-			foundation::operator_register::register_plus_assign<types::string_type>(m);
+					[](const types::string_type& string, const types::char_type other) -> decltype(auto) { return string + other; },
+					builtin_attribute::operation);
+			foundation::operator_register::register_plus_assign<types::string_type>(m, {}, builtin_attribute::mutation);
 			foundation::operator_register::register_plus_assign<types::string_type>(
 					m,
-					[](types::string_type& string, const types::char_type other) -> decltype(auto) { return string += other; });
+					[](types::string_type& string, const types::char_type other) -> decltype(auto) { return string += other; },
+					builtin_attribute::mutation);
 			// operator*/operator*=
-			foundation::operator_register::register_multiply<types::string_type>(m, &types::string_type::operator*);
-			foundation::operator_register::register_multiply_assign<types::string_type>(m, &types::string_type::operator*=);
+			foundation::operator_register::register_multiply<types::string_type>(m, &types::string_type::operator*, builtin_attribute::operation);
+			foundation::operator_register::register_multiply_assign<types::string_type>(m, &types::string_type::operator*=, builtin_attribute::mutation);
 
 			// ==/!=</<=/>/>=
-			register_comparison<types::string_type>(m);
+			register_comparison<types::string_type>(m, builtin_attribute::query);
 
 			// string.view()
 			register_view_type<types::string_type>(m);
@@ -367,57 +403,70 @@ namespace gal::lang::plugin
 			// string[index]
 			m.add_function(
 					foundation::container_subscript_interface_name::value,
-					fun(static_cast<types::string_type::reference (types::string_type::*)(types::string_type::difference_type) noexcept>(&types::string_type::get)));
+					fun(static_cast<types::string_type::reference (types::string_type::*)(types::string_type::difference_type) noexcept>(&types::string_type::get)),
+					builtin_attribute::accessor);
 			m.add_function(
 					foundation::container_subscript_interface_name::value,
-					fun(static_cast<types::string_type::const_reference (types::string_type::*)(types::string_type::difference_type) const noexcept>(&types::string_type::get)));
+					fun(static_cast<types::string_type::const_reference (types::string_type::*)(types::string_type::difference_type) const noexcept>(&types::string_type::get)),
+					builtin_attribute::accessor);
 
 			// string.size()
 			m.add_function(
 					foundation::container_size_interface_name::value,
-					fun(&types::string_type::size));
+					fun(&types::string_type::size),
+					builtin_attribute::query);
 
 			// string.empty()
 			m.add_function(
 					foundation::container_empty_interface_name::value,
-					fun(&types::string_type::empty));
+					fun(&types::string_type::empty),
+					builtin_attribute::query);
 
 			// string.clear()
 			m.add_function(
 					foundation::container_clear_interface_name::value,
-					fun(&types::string_type::clear));
+					fun(&types::string_type::clear),
+					builtin_attribute::mutation);
 
 			// string.front()
 			m.add_function(
 					foundation::container_front_interface_name::value,
-					fun(static_cast<types::string_type::reference (types::string_type::*)() noexcept>(&types::string_type::front)));
+					fun(static_cast<types::string_type::reference (types::string_type::*)() noexcept>(&types::string_type::front)),
+					builtin_attribute::accessor);
 			m.add_function(
 					foundation::container_front_interface_name::value,
-					fun(static_cast<types::string_type::const_reference (types::string_type::*)() const noexcept>(&types::string_type::front)));
+					fun(static_cast<types::string_type::const_reference (types::string_type::*)() const noexcept>(&types::string_type::front)),
+					builtin_attribute::accessor);
 
 			// string.back()
 			m.add_function(
 					foundation::container_back_interface_name::value,
-					fun(static_cast<types::string_type::reference (types::string_type::*)() noexcept>(&types::string_type::back)));
+					fun(static_cast<types::string_type::reference (types::string_type::*)() noexcept>(&types::string_type::back)),
+					builtin_attribute::accessor);
 			m.add_function(
 					foundation::container_back_interface_name::value,
-					fun(static_cast<types::string_type::const_reference (types::string_type::*)() const noexcept>(&types::string_type::back)));
+					fun(static_cast<types::string_type::const_reference (types::string_type::*)() const noexcept>(&types::string_type::back)),
+					builtin_attribute::accessor);
 
 			// string.insert_at(index, value)/string.erase_at(index)
 			m.add_function(
 					foundation::container_insert_interface_name::value,
-					fun(&types::string_type::insert_at));
+					fun(&types::string_type::insert_at),
+					builtin_attribute::mutation);
 			m.add_function(
 					foundation::container_erase_interface_name::value,
-					fun(&types::string_type::erase_at));
+					fun(&types::string_type::erase_at),
+					builtin_attribute::mutation);
 
 			// string.push_back(value)/string.pop_back()
 			m.add_function(
 					foundation::container_push_back_interface_name::value,
-					fun(&types::string_type::push_back));
+					fun(&types::string_type::push_back),
+					builtin_attribute::mutation);
 			m.add_function(
 					foundation::container_pop_back_interface_name::value,
-					fun(&types::string_type::pop_back));
+					fun(&types::string_type::pop_back),
+					builtin_attribute::mutation);
 
 			// todo: extra interface
 		}
@@ -457,7 +506,7 @@ namespace gal::lang::plugin
 			register_movable_container<types::string_view_type>(foundation::string_view_type_name::value, m);
 
 			// ==/!=</<=/>/>=
-			register_comparison<types::string_view_type>(m);
+			register_comparison<types::string_view_type>(m, builtin_attribute::query);
 
 			// string.view()
 			register_view_type<types::string_view_type>(m);
@@ -465,27 +514,32 @@ namespace gal::lang::plugin
 			// string[index]
 			m.add_function(
 					foundation::container_subscript_interface_name::value,
-					fun(&types::string_view_type::get));
+					fun(&types::string_view_type::get),
+					builtin_attribute::accessor);
 
 			// string.size()
 			m.add_function(
 					foundation::container_size_interface_name::value,
-					fun(&types::string_view_type::size));
+					fun(&types::string_view_type::size),
+					builtin_attribute::query);
 
 			// string.empty()
 			m.add_function(
 					foundation::container_empty_interface_name::value,
-					fun(&types::string_view_type::empty));
+					fun(&types::string_view_type::empty),
+					builtin_attribute::query);
 
 			// string.front()
 			m.add_function(
 					foundation::container_front_interface_name::value,
-					fun(&types::string_view_type::front));
+					fun(&types::string_view_type::front),
+					builtin_attribute::accessor);
 
 			// string.back()
 			m.add_function(
 					foundation::container_back_interface_name::value,
-					fun(&types::string_view_type::back));
+					fun(&types::string_view_type::back),
+					builtin_attribute::accessor);
 
 			// todo: extra interface
 
@@ -496,11 +550,13 @@ namespace gal::lang::plugin
 		{
 			// number
 			m.add_function(foundation::operator_to_string_name::value,
-			               fun([](const types::number_type& num) -> decltype(auto) { return types::string_type{num.to_string()}; }));
+			               fun([](const types::number_type& num) -> decltype(auto) { return types::string_type{num.to_string()}; }),
+			               builtin_attribute::operation);
 
 			// range
 			m.add_function(foundation::operator_to_string_name::value,
-			               fun([](const types::range_type& range) -> decltype(auto) { return types::string_type{std_format::format("range(begin={}, end={}, step={})", range.begin(), range.end(), range.step())}; }));
+			               fun([](const types::range_type& range) -> decltype(auto) { return types::string_type{std_format::format("range(begin={}, end={}, step={})", range.begin(), range.end(), range.step())}; }),
+			               builtin_attribute::operation);
 
 			// list
 			// m.add_evaluation(
@@ -530,11 +586,13 @@ namespace gal::lang::plugin
 
 			// string
 			m.add_function(foundation::operator_to_string_name::value,
-			               fun([](const types::string_type& string) -> decltype(auto) { return string; }));
+			               fun([](const types::string_type& string) -> decltype(auto) { return string; }),
+			               builtin_attribute::accessor);
 
 			// string_view
 			m.add_function(foundation::operator_to_string_name::value,
-			               fun([](const types::string_view_type& string) -> decltype(auto) { return string; }));
+			               fun([](const types::string_view_type& string) -> decltype(auto) { return string; }),
+			               builtin_attribute::accessor);
 		}
 
 		static void register_print(foundation::engine_module& m)
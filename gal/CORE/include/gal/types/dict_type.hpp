@@ -4,7 +4,9 @@
 	#define GAL_LANG_TYPES_DICT_TYPE_HPP
 
 #include <unordered_map>
+#include <vector>
 #include <utils/format.hpp>
+#include <utils/copy_on_write.hpp>
 #include <gal/types/view_type.hpp>
 #include <gal/types/string_view_type.hpp>
 #include <gal/foundation/type_info.hpp>
@@ -49,8 +51,8 @@ namespace gal::lang
 			using mapped_reference = mapped_type&;
 			using mapped_const_reference = const mapped_type&;
 
-			using view_type = types::view_type<container_type>;
-			using const_view_type = types::view_type<const container_type>;
+			// the view shares the storage of the dict, so modifying the dict while iterating it does not invalidate the view
+			using const_view_type = types::view_type<const container_type, utils::copy_on_write<container_type>>;
 
 			static const foundation::gal_type_info& class_type() noexcept
 			{
@@ -67,7 +69,8 @@ namespace gal::lang
 			}
 
 		private:
-			container_type data_;
+			// copies of a dict share the elements until one of them is modified
+			utils::copy_on_write<container_type> data_;
 
 			explicit dict_type(container_type&& map)
 				: data_{std::move(map)} {}
@@ -89,7 +92,6 @@ namespace gal::lang
 			// }
 
 			// view interface
-			[[nodiscard]] view_type view() noexcept { return view_type{data_}; }
 			[[nodiscard]] const_view_type view() const noexcept { return const_view_type{data_}; }
 
 			//*************************************************************************
@@ -97,29 +99,41 @@ namespace gal::lang
 			//*************************************************************************
 
 			// operator[]
-			[[nodiscard]] mapped_reference get(key_const_reference key) { return data_[key]; }
+			[[nodiscard]] mapped_reference get(key_const_reference key) { return data_.write()[key]; }
 
 			// operator[]
 			[[nodiscard]] mapped_const_reference get(key_const_reference key) const
 			{
-				if (const auto it = data_.find(key); it != data_.end()) { return it->second; }
+				const auto& data = data_.read();
+				if (const auto it = data.find(key); it != data.end()) { return it->second; }
 
 				throw exception::key_not_found_error{key};
 			}
 
-			[[nodiscard]] size_type size() const noexcept { return data_.size(); }
+			[[nodiscard]] size_type size() const noexcept { return data_.read().size(); }
 
-			[[nodiscard]] bool empty() const noexcept { return data_.empty(); }
+			[[nodiscard]] bool empty() const noexcept { return data_.read().empty(); }
 
-			void clear() noexcept { data_.clear(); }
+			void clear() noexcept { data_ = {}; }
+
+			/**
+			 * @brief Append the elements to children, for the cycle collector (see foundation::cycle_collector).
+			 * The elements shared with another copy of the dict are not reported, they are not owned by this dict alone.
+			 */
+			void trace(std::vector<const foundation::boxed_value*>& children) const
+			{
+				if (data_.is_shared()) { return; }
+
+				for (const auto& [_, value]: data_.read()) { children.push_back(&value); }
+			}
 
 			// insert is not necessary
 
-			void erase_at(key_const_reference key) { data_.erase(key); }
+			void erase_at(key_const_reference key) { data_.write().erase(key); }
 
 			// internal use only
 			template<typename... Args>
-			decltype(auto) emplace(Args&&... args) { return data_.emplace(std::forward<Args>(args)...); }
+			decltype(auto) emplace(Args&&... args) { return data_.write().emplace(std::forward<Args>(args)...); }
 
 			//*************************************************************************
 			//*********************** EXTRA INTERFACE *******************************
@@ -4,6 +4,8 @@
 #define GAL_LANG_TYPES_LIST_TYPE_HPP
 
 #include <list>
+#include <vector>
+#include <utils/copy_on_write.hpp>
 #include <gal/types/view_type.hpp>
 #include <gal/foundation/type_info.hpp>
 
@@ -29,8 +31,8 @@ namespace gal::lang
 			using iterator = container_type::iterator;
 			using const_iterator = container_type::const_iterator;
 
-			using view_type = types::view_type<container_type>;
-			using const_view_type = types::view_type<const container_type>;
+			// the view shares the storage of the list, so modifying the list while iterating it does not invalidate the view
+			using const_view_type = types::view_type<const container_type, utils::copy_on_write<container_type>>;
 
 			static const foundation::gal_type_info& class_type() noexcept
 			{
@@ -40,12 +42,13 @@ namespace gal::lang
 			}
 
 		private:
-			container_type data_;
+			// copies of a list share the elements until one of them is modified
+			utils::copy_on_write<container_type> data_;
 
 			[[nodiscard]] difference_type locate_index(const difference_type index) const noexcept
 			{
-				auto i = index % static_cast<difference_type>(data_.size());
-				if (i < 0) { i = static_cast<difference_type>(data_.size()) + i; }
+				auto i = index % static_cast<difference_type>(size());
+				if (i < 0) { i = static_cast<difference_type>(size()) + i; }
 				return i;
 			}
 
@@ -56,10 +59,10 @@ namespace gal::lang
 			list_type() noexcept = default;
 
 			explicit list_type(foundation::parameters_type&& list)
-				: data_{std::make_move_iterator(list.begin()), std::make_move_iterator(list.end())} {}
+				: data_{std::in_place, std::make_move_iterator(list.begin()), std::make_move_iterator(list.end())} {}
 
 			explicit list_type(const foundation::parameters_view_type list)
-				: data_{list.begin(), list.end()} {}
+				: data_{std::in_place, list.begin(), list.end()} {}
 
 			// [[nodiscard]] list_type operator+(const list_type& other) const
 			// {
@@ -89,7 +92,6 @@ namespace gal::lang
 			// }
 
 			// view interface
-			[[nodiscard]] view_type view() noexcept { return view_type{data_}; }
 			[[nodiscard]] const_view_type view() const noexcept { return const_view_type{data_}; }
 
 			//*************************************************************************
@@ -97,36 +99,57 @@ namespace gal::lang
 			//*************************************************************************
 
 			// operator[]
-			[[nodiscard]] reference get(const difference_type index) noexcept { return *std::ranges::next(data_.begin(), locate_index(index)); }
+			[[nodiscard]] reference get(const difference_type index) noexcept { return *std::ranges::next(data_.write().begin(), locate_index(index)); }
 
 			// operator[]
-			[[nodiscard]] const_reference get(const difference_type index) const noexcept { return *std::ranges::next(data_.begin(), locate_index(index)); }
+			[[nodiscard]] const_reference get(const difference_type index) const noexcept { return *std::ranges::next(data_.read().begin(), locate_index(index)); }
 
-			[[nodiscard]] size_type size() const noexcept { return data_.size(); }
+			[[nodiscard]] size_type size() const noexcept { return data_.read().size(); }
 
-			[[nodiscard]] bool empty() const noexcept { return data_.empty(); }
+			[[nodiscard]] bool empty() const noexcept { return data_.read().empty(); }
 
-			void clear() noexcept { data_.clear(); }
+			void clear() noexcept { data_ = {}; }
 
-			[[nodiscard]] reference front() noexcept { return data_.front(); }
+			/**
+			 * @brief Append the elements to children, for the cycle collector (see foundation::cycle_collector).
+			 * The elements shared with another copy of the list are not reported, they are not owned by this list alone.
+			 */
+			void trace(std::vector<const foundation::boxed_value*>& children) const
+			{
+				if (data_.is_shared()) { return; }
+
+				for (const auto& value: data_.read()) { children.push_back(&value); }
+			}
+
+			[[nodiscard]] reference front() noexcept { return data_.write().front(); }
 
-			[[nodiscard]] const_reference front() const noexcept { return data_.front(); }
+			[[nodiscard]] const_reference front() const noexcept { return data_.read().front(); }
 
-			[[nodiscard]] reference back() noexcept { return data_.back(); }
+			[[nodiscard]] reference back() noexcept { return data_.write().back(); }
 
-			[[nodiscard]] const_reference back() const noexcept { return data_.back(); }
+			[[nodiscard]] const_reference back() const noexcept { return data_.read().back(); }
 
-			void insert_at(const difference_type index, const_reference value) noexcept { data_.insert(std::ranges::next(data_.begin(), locate_index(index)), value); }
+			void insert_at(const difference_type index, const_reference value) noexcept
+			{
+				const auto i = locate_index(index);
+				auto& data = data_.write();
+				data.insert(std::ranges::next(data.begin(), i), value);
+			}
 
-			void erase_at(const difference_type index) { data_.erase(std::ranges::next(data_.begin(), locate_index(index))); }
+			void erase_at(const difference_type index)
+			{
+				const auto i = locate_index(index);
+				auto& data = data_.write();
+				data.erase(std::ranges::next(data.begin(), i));
+			}
 
-			void push_back(const_reference value) { data_.push_back(value); }
+			void push_back(const_reference value) { data_.write().push_back(value); }
 
-			void pop_back() { data_.pop_back(); }
+			void pop_back() { data_.write().pop_back(); }
 
-			void push_front(const_reference value) { data_.push_front(value); }
+			void push_front(const_reference value) { data_.write().push_front(value); }
 
-			void pop_front() { data_.pop_front(); }
+			void pop_front() { data_.write().pop_front(); }
 
 			//*************************************************************************
 			//*********************** EXTRA INTERFACE *******************************
@@ -149,33 +172,34 @@ namespace gal::lang
 				const auto b = locate_index(begin);
 				const auto e = locate_index(end);
 
-				if (b <= e) { return data_ | std::views::drop(b) | std::views::take(e - b); }
-				return data_ | std::views::drop(0) | std::views::take(0);
+				auto& data = data_.write();
+				if (b <= e) { return data | std::views::drop(b) | std::views::take(e - b); }
+				return data | std::views::drop(0) | std::views::take(0);
 			}
 
-			[[nodiscard]] auto slice_front(const difference_type begin) { return slice(begin, data_.size()); }
+			[[nodiscard]] auto slice_front(const difference_type begin) { return slice(begin, static_cast<difference_type>(size())); }
 
 			[[nodiscard]] auto slice_back(const difference_type end) { return slice(0, end); }
 
-			void reverse() { data_.reverse(); }
+			void reverse() { data_.write().reverse(); }
 
 			// the type cast of the sorting function is up to the caller
 			// note: boxed_value does not have any form of comparison operation, so there is no default sort method
 			template<typename Predicate>
 				requires std::is_invocable_r_v<bool, Predicate, const foundation::boxed_value&, const foundation::boxed_value>
-			void sort(Predicate&& p) { data_.sort(std::forward<Predicate>(p)); }
+			void sort(Predicate&& p) { data_.write().sort(std::forward<Predicate>(p)); }
 
 			// the type cast of the sorting function is up to the caller
 			// note: boxed_value does not have any form of comparison operation, so there is no default unique method
 			template<typename Predicate>
 				requires std::is_invocable_r_v<bool, Predicate, const foundation::boxed_value&, const foundation::boxed_value>
-			void unique(Predicate&& p) { data_.unique(std::forward<Predicate>(p)); }
+			void unique(Predicate&& p) { data_.write().unique(std::forward<Predicate>(p)); }
 
 			// the type cast of the sorting function is up to the caller
 			// note: boxed_value does not have any form of comparison operation, so there is no default count method
 			template<typename Predicate>
 				requires std::is_invocable_r_v<bool, Predicate, const foundation::boxed_value&>
-			[[nodiscard]] size_type count_if(Predicate&& p) { return std::ranges::count_if(data_, std::forward<Predicate>(p)); }
+			[[nodiscard]] size_type count_if(Predicate&& p) { return std::ranges::count_if(data_.read(), std::forward<Predicate>(p)); }
 
 			// todo: more interface
 		};
@@ -7,6 +7,8 @@
 #include <gal/boxed_value.hpp>
 #include <gal/foundation/algebraic.hpp>
 #include <utils/format.hpp>
+#include <charconv>
+#include <optional>
 
 namespace gal::lang
 {
@@ -121,7 +123,7 @@ namespace gal::lang
 				if (ti == foundation::make_type_info<long>()) { return get_integral_type<sizeof(long), true>(); }
 				if (ti == foundation::make_type_info<unsigned long>()) { return get_integral_type<sizeof(unsigned long), false>(); }
 				if (ti == foundation::make_type_info<long long>()) { return get_integral_type<sizeof(long long), true>(); }
-				if (ti == foundation::make_type_info<unsigned long long>()) { return get_integral_type<sizeof(unsigned long long), true>(); }
+				if (ti == foundation::make_type_info<unsigned long long>()) { return get_integral_type<sizeof(unsigned long long), false>(); }
 
 				throw std::bad_any_cast{};
 			}
@@ -135,14 +137,14 @@ namespace gal::lang
 				switch (get_type(object))
 				{
 						using enum numeric_type;
-					case int8_type: { return function(*static_cast<const std::uint8_t*>(object.get_const_raw())); }
-					case uint8_type: { return function(*static_cast<const std::int8_t*>(object.get_const_raw())); }
-					case int16_type: { return function(*static_cast<const std::uint16_t*>(object.get_const_raw())); }
-					case uint16_type: { return function(*static_cast<const std::int16_t*>(object.get_const_raw())); }
-					case int32_type: { return function(*static_cast<const std::uint32_t*>(object.get_const_raw())); }
-					case uint32_type: { return function(*static_cast<const std::int32_t*>(object.get_const_raw())); }
-					case int64_type: { return function(*static_cast<const std::uint64_t*>(object.get_const_raw())); }
-					case uint64_type: { return function(*static_cast<const std::int64_t*>(object.get_const_raw())); }
+					case int8_type: { return function(*static_cast<const std::int8_t*>(object.get_const_raw())); }
+					case uint8_type: { return function(*static_cast<const std::uint8_t*>(object.get_const_raw())); }
+					case int16_type: { return function(*static_cast<const std::int16_t*>(object.get_const_raw())); }
+					case uint16_type: { return function(*static_cast<const std::uint16_t*>(object.get_const_raw())); }
+					case int32_type: { return function(*static_cast<const std::int32_t*>(object.get_const_raw())); }
+					case uint32_type: { return function(*static_cast<const std::uint32_t*>(object.get_const_raw())); }
+					case int64_type: { return function(*static_cast<const std::int64_t*>(object.get_const_raw())); }
+					case uint64_type: { return function(*static_cast<const std::uint64_t*>(object.get_const_raw())); }
 					case float_type: { return function(*static_cast<const float*>(object.get_const_raw())); }
 					case double_type: { return function(*static_cast<const double*>(object.get_const_raw())); }
 					case long_double_type: { return function(*static_cast<const long double*>(object.get_const_raw())); }
@@ -407,6 +409,35 @@ namespace gal::lang
 				return false;
 			}
 
+			/**
+			 * @brief Get an integral number as a key (e.g. of a jump table), two numbers with the same signedness are equal if and only if their keys are equal.
+			 *
+			 * @return the key and whether the number is signed, or nothing if the number is not integral.
+			 */
+			[[nodiscard]] static std::optional<std::pair<std::int64_t, bool>> integral_key(const foundation::boxed_value& value)
+			{
+				if (const auto& ti = value.type_info();
+					ti.bare_equal(foundation::make_type_info<bool>()) || not ti.is_arithmetic()) { return std::nullopt; }
+
+				switch (get_type(value))
+				{
+						using enum numeric_type;
+					case int8_type:
+					case int16_type:
+					case int32_type:
+					case int64_type: { return std::make_pair(number_type{value}.as<std::int64_t>(), true); }
+					case uint8_type:
+					case uint16_type:
+					case uint32_type:
+					case uint64_type: { return std::make_pair(static_cast<std::int64_t>(number_type{value}.as<std::uint64_t>()), false); }
+					case float_type:
+					case double_type:
+					case long_double_type: { return std::nullopt; }
+				}
+
+				return std::nullopt;
+			}
+
 			[[nodiscard]] static foundation::boxed_value clone(const foundation::boxed_value& object) { return number_type{object}.as(object.type_info()).value; }
 
 			static auto binary_invoke(foundation::algebraic_operations operation, const foundation::boxed_value& lhs, const foundation::boxed_value& rhs)
@@ -433,6 +464,41 @@ namespace gal::lang
 						lhs_visitor);
 			}
 
+			using binary_invoker_type = foundation::boxed_value (*)(foundation::algebraic_operations operation, const foundation::boxed_value& lhs, const foundation::boxed_value& rhs);
+
+			/**
+			 * @brief Get the binary_invoke specialized for the types of lhs and rhs, it skips the type dispatch.
+			 *
+			 * @note The invoker only accepts the operands of the same types as lhs and rhs.
+			 * @throw std::bad_any_cast not support numeric type
+			 */
+			[[nodiscard]] static binary_invoker_type binary_invoker(const foundation::boxed_value& lhs, const foundation::boxed_value& rhs)
+			{
+				auto lhs_visitor = [&rhs]<typename T>(const T&)
+				{
+					auto rhs_visitor = []<typename U>(const U&) -> binary_invoker_type
+					{
+						return [](const foundation::algebraic_operations operation, const foundation::boxed_value& l, const foundation::boxed_value& r) -> foundation::boxed_value
+						{
+							return number_type::do_binary_invoke(
+									l,
+									operation,
+									l.is_xvalue() ? nullptr : static_cast<T*>(l.get_raw()),
+									*static_cast<const T*>(l.get_const_raw()),
+									*static_cast<const U*>(r.get_const_raw()));
+						};
+					};
+
+					return number_type::visit(
+							rhs,
+							rhs_visitor);
+				};
+
+				return visit(
+						lhs,
+						lhs_visitor);
+			}
+
 			static auto unary_invoke(const foundation::boxed_value& object, foundation::algebraic_operations operation)
 			{
 				auto unary_operator = [operation]<typename T>(const T& self)
@@ -704,6 +770,50 @@ namespace gal::lang
 
 				throw std::bad_any_cast{};
 			}
+
+			/**
+			 * @brief The maximum number of characters append_to may write.
+			 */
+			constexpr static std::size_t max_chars_length = 64;
+
+			/**
+			 * @brief Append the shortest representation of the number to the dest (same as to_string, but without temporary string).
+			 *
+			 * @note If the capacity of the dest is at least dest.size() + max_chars_length, no reallocation takes place.
+			 *
+			 * @throw std::bad_any_cast not supported numeric type
+			 */
+			void append_to(foundation::string_type& dest) const
+			{
+				const auto append = [&dest](const auto number)
+				{
+					const auto old_size = dest.size();
+					dest.resize(old_size + max_chars_length);
+
+					[[maybe_unused]] const auto [end, ec] = std::to_chars(dest.data() + old_size, dest.data() + dest.size(), number);
+					gal_assert(ec == std::errc{});
+
+					dest.resize(static_cast<std::size_t>(end - dest.data()));
+				};
+
+				switch (get_type(value))
+				{
+						using enum numeric_type;
+					case int8_type: { return append(as<std::int8_t>()); }
+					case uint8_type: { return append(as<std::uint8_t>()); }
+					case int16_type: { return append(as<std::int16_t>()); }
+					case uint16_type: { return append(as<std::uint16_t>()); }
+					case int32_type: { return append(as<std::int32_t>()); }
+					case uint32_type: { return append(as<std::uint32_t>()); }
+					case int64_type: { return append(as<std::int64_t>()); }
+					case uint64_type: { return append(as<std::uint64_t>()); }
+					case float_type: { return append(as<float>()); }
+					case double_type: { return append(as<double>()); }
+					case long_double_type: { return append(as<long double>()); }
+				}
+
+				throw std::bad_any_cast{};
+			}
 		};
 	}// namespace types
 
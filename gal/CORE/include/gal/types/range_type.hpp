@@ -46,7 +46,16 @@ namespace gal::lang::types
 
 		[[nodiscard]] constexpr size_type get() const noexcept { return begin_; }
 
-		[[nodiscard]] constexpr bool next() noexcept { return (begin_ += step_) < end_; }
+		/**
+		 * @brief Whether there is no more value in the range, a zero step makes the range empty.
+		 */
+		[[nodiscard]] constexpr bool empty() const noexcept { return step_ > 0 ? begin_ >= end_ : (step_ == 0 || begin_ <= end_); }
+
+		[[nodiscard]] constexpr bool next() noexcept
+		{
+			begin_ += step_;
+			return not empty();
+		}
 
 		[[nodiscard]] constexpr size_type size() const noexcept { return (end_ - begin_) / step_; }
 
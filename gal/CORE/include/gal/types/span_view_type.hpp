@@ -0,0 +1,112 @@
+#pragma once
+
+#ifndef GAL_LANG_TYPES_SPAN_VIEW_TYPE_HPP
+#define GAL_LANG_TYPES_SPAN_VIEW_TYPE_HPP
+
+#include <gal/foundation/type_info.hpp>
+#include <gal/foundation/boxed_value.hpp>
+#include <span>
+#include <stdexcept>
+
+namespace gal::lang::types
+{
+	/**
+	 * @brief A view of a contiguous sequence owned by the host, the elements are not boxed until they are accessed.
+	 *
+	 * @note The host is responsible for keeping the sequence alive as long as the script uses the view.
+	 */
+	template<typename T>
+	class span_view_type
+	{
+	public:
+		using container_type = std::span<T>;
+
+		using element_type = T;
+		using value_type = std::remove_cv_t<T>;
+		using size_type = typename container_type::size_type;
+		using difference_type = typename container_type::difference_type;
+		using reference = T&;
+		using const_reference = const T&;
+		using pointer = T*;
+
+		constexpr static bool is_const_element = std::is_const_v<element_type>;
+		// const arithmetic elements are accessed by value (inline number), others by reference (so they can be assigned)
+		constexpr static bool is_inline_element = is_const_element && std::is_arithmetic_v<value_type>;
+
+		using access_type = std::conditional_t<is_inline_element, value_type, reference>;
+
+		// see also foundation/name.hpp => container_view_xxx_interface_name
+		class view_type
+		{
+		private:
+			pointer begin_;
+			pointer end_;
+
+		public:
+			static const foundation::gal_type_info& class_type() noexcept
+			{
+				GAL_LANG_TYPE_INFO_DEBUG_DO_OR(constexpr,)
+				static foundation::gal_type_info type = foundation::make_type_info<view_type>();
+				return type;
+			}
+
+			constexpr view_type(const pointer begin, const pointer end) noexcept
+				: begin_{begin},
+				  end_{end} {}
+
+			[[nodiscard]] constexpr bool empty() const noexcept { return begin_ == end_; }
+
+			[[nodiscard]] foundation::boxed_value get() const
+			{
+				if constexpr (is_inline_element) { return foundation::boxed_value{value_type{*begin_}}; }
+				else if constexpr (is_const_element) { return foundation::boxed_value{std::cref(*begin_)}; }
+				else { return foundation::boxed_value{std::ref(*begin_)}; }
+			}
+
+			constexpr void advance() noexcept { ++begin_; }
+		};
+
+		static const foundation::gal_type_info& class_type() noexcept
+		{
+			GAL_LANG_TYPE_INFO_DEBUG_DO_OR(constexpr,)
+			static foundation::gal_type_info type = foundation::make_type_info<span_view_type>();
+			return type;
+		}
+
+	private:
+		container_type data_;
+
+		constexpr void check_index(const difference_type index) const
+		{
+			if (index < 0 || static_cast<size_type>(index) >= data_.size()) { throw std::out_of_range{"span_view index out of range"}; }
+		}
+
+	public:
+		constexpr span_view_type() noexcept = default;
+
+		constexpr explicit span_view_type(const container_type data) noexcept
+			: data_{data} {}
+
+		[[nodiscard]] constexpr container_type data() const noexcept { return data_; }
+
+		// view interface
+		[[nodiscard]] constexpr view_type view() const noexcept { return {data_.data(), data_.data() + data_.size()}; }
+
+		//*************************************************************************
+		//*********************** BASIC INTERFACE *******************************
+		//*************************************************************************
+
+		// operator[]
+		[[nodiscard]] constexpr access_type get(const difference_type index) const
+		{
+			check_index(index);
+			return data_[static_cast<size_type>(index)];
+		}
+
+		[[nodiscard]] constexpr size_type size() const noexcept { return data_.size(); }
+
+		[[nodiscard]] constexpr bool empty() const noexcept { return data_.empty(); }
+	};
+}
+
+#endif // GAL_LANG_TYPES_SPAN_VIEW_TYPE_HPP
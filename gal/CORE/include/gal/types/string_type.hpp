@@ -6,6 +6,7 @@
 #include <gal/foundation/string.hpp>
 #include <gal/types/view_type.hpp>
 #include <gal/foundation/type_info.hpp>
+#include <utils/hash.hpp>
 
 namespace gal::lang::types
 {
@@ -172,7 +173,7 @@ namespace gal::lang::types
 template<>
 struct std::hash<gal::lang::types::string_type>
 {
-	[[nodiscard]] std::size_t operator()(const gal::lang::types::string_type& string) const noexcept { return std::hash<gal::lang::types::string_type::container_type>{}(string.data()); }
+	[[nodiscard]] std::size_t operator()(const gal::lang::types::string_type& string) const noexcept { return static_cast<std::size_t>(gal::utils::hash_wyhash(string.data())); }
 };
 
 template<>
@@ -188,7 +189,7 @@ struct std::equal_to<gal::lang::types::string_type>
 template<>
 struct std::hash<gal::lang::types::string_view_type>
 {
-	[[nodiscard]] std::size_t operator()(const gal::lang::types::string_view_type& object) const noexcept { return std::hash<gal::lang::types::string_view_type::container_type>{}(object.data()); }
+	[[nodiscard]] std::size_t operator()(const gal::lang::types::string_view_type& object) const noexcept { return static_cast<std::size_t>(gal::utils::hash_wyhash(object.data())); }
 };
 
 template<>
@@ -15,11 +15,16 @@ namespace gal::lang
 	namespace types
 	{
 		// see also foundation/name.hpp => container_view_xxx_interface_name
-		template<typename ContainerType>
+		// if Storage is not void, the view holds a copy of the (utils::copy_on_write) storage of the container,
+		// writing to (or destroying) the container during the iteration detaches the container instead of invalidating the view
+		template<typename ContainerType, typename Storage = void>
 		class view_type
 		{
 		public:
 			using container_type = ContainerType;
+			using storage_type = Storage;
+
+			constexpr static bool has_storage = not std::is_void_v<storage_type>;
 
 			constexpr static bool is_const_container = std::is_const_v<container_type>;
 
@@ -29,25 +34,35 @@ namespace gal::lang
 			static const foundation::gal_type_info& class_type() noexcept
 			{
 				GAL_LANG_TYPE_INFO_DEBUG_DO_OR(constexpr,)
-				static foundation::gal_type_info type = foundation::make_type_info<view_type<container_type>>();
+				static foundation::gal_type_info type = foundation::make_type_info<view_type>();
 				return type;
 			}
 
 		private:
+			struct no_storage { };
+
+			// declared before the iterators, they point into it
+			[[no_unique_address]] std::conditional_t<has_storage, storage_type, no_storage> storage_;
 			iterator_type begin_;
 			iterator_type end_;
 
 		public:
 			constexpr explicit view_type(container_type& container) noexcept
-				requires(not is_const_container)
+				requires(not is_const_container && not has_storage)
 				: begin_{std::ranges::begin(container)},
 				  end_{std::ranges::end(container)} {}
 
 			constexpr explicit view_type(const container_type& container) noexcept
-				requires is_const_container
+				requires(is_const_container && not has_storage)
 				: begin_{std::ranges::begin(container)},
 				  end_{std::ranges::end(container)} {}
 
+			explicit view_type(const storage_type& storage) noexcept
+				requires(is_const_container && has_storage)
+				: storage_{storage},
+				  begin_{std::ranges::begin(storage_.read())},
+				  end_{std::ranges::end(storage_.read())} {}
+
 			[[nodiscard]] constexpr bool empty() const noexcept { return begin_ == end_; }
 
 			[[nodiscard]] constexpr foundation::boxed_value get() noexcept
@@ -4,6 +4,7 @@
 #define GAL_UTILS_CONSTEXPR_STRING_BASE_HPP
 
 #include <type_traits>
+#include <utils/hash.hpp>
 
 namespace gal::utils
 {
@@ -15,6 +16,16 @@ namespace gal::utils
 		using value_type = ValueType;
 		using size_type = SizeType;
 
+		/**
+		 * @brief Same as utils::hash_wyhash(string_view{value, size_no_0}), but it is a compile-time constant.
+		 */
+		[[nodiscard]] constexpr static std::uint64_t hash() noexcept
+			requires requires
+			{
+				derived_type::size_no_0;
+				derived_type::value;
+			} { return hash_wyhash(std::basic_string_view<value_type>{derived_type::value, derived_type::size_no_0}); }
+
 		[[nodiscard]] constexpr static bool match(const value_type* string) noexcept
 			requires requires
 			{
@@ -0,0 +1,67 @@
+#pragma once
+
+#ifndef GAL_UTILS_COPY_ON_WRITE_HPP
+#define GAL_UTILS_COPY_ON_WRITE_HPP
+
+#include <utility>
+#include <utils/reference_count.hpp>
+
+namespace gal::utils
+{
+	/**
+	 * @brief A value whose copies share the same data until one of them is written.
+	 * Copying a copy_on_write is O(1), the data is copied by the first write() of a shared copy.
+	 *
+	 * @note The reference returned by write() is only valid until the next copy of this object,
+	 * after that the data is shared again.
+	 */
+	template<typename T>
+	class copy_on_write
+	{
+	public:
+		using value_type = T;
+
+	private:
+		struct holder : shared_handle_base
+		{
+			value_type value;
+
+			template<typename... Args>
+			explicit holder(std::in_place_t, Args&&... args)
+				: value(std::forward<Args>(args)...) {}
+		};
+
+		// null if empty (default constructed or moved from)
+		shared_handle<holder> data_;
+
+	public:
+		constexpr copy_on_write() noexcept = default;
+
+		explicit copy_on_write(value_type&& value)
+			: data_{make_shared_handle<holder>(std::in_place, std::move(value))} {}
+
+		template<typename... Args>
+		explicit copy_on_write(std::in_place_t, Args&&... args)
+			: data_{make_shared_handle<holder>(std::in_place, std::forward<Args>(args)...)} {}
+
+		[[nodiscard]] const value_type& read() const noexcept
+		{
+			if (data_) { return data_->value; }
+
+			static const value_type empty{};
+			return empty;
+		}
+
+		[[nodiscard]] value_type& write()
+		{
+			if (not data_) { data_ = make_shared_handle<holder>(std::in_place); }
+			else if (data_.use_count() != 1) { data_ = make_shared_handle<holder>(std::in_place, std::as_const(data_->value)); }
+
+			return data_->value;
+		}
+
+		[[nodiscard]] bool is_shared() const noexcept { return data_ && data_.use_count() != 1; }
+	};
+}
+
+#endif // GAL_UTILS_COPY_ON_WRITE_HPP
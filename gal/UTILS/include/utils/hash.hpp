@@ -3,7 +3,12 @@
 #ifndef GAL_UTILS_HASH_HPP
 #define GAL_UTILS_HASH_HPP
 
+#include <bit>
 #include <cstdint>
+#include <cstring>
+#include <ranges>
+#include <string_view>
+#include <type_traits>
 
 namespace gal::utils
 {
@@ -59,6 +64,179 @@ namespace gal::utils
 		hash += hash << 15;
 		return hash;
 	}
+
+	namespace hash_detail
+	{
+		constexpr std::uint64_t wyhash_secret[]{0x2d358dccaa6c78a5ull, 0x8bb84b93962eacc9ull, 0x4b33a62ed433d4a3ull, 0x4d5a2da51de1aa47ull};
+
+		/**
+		 * @brief 64x64->128 multiply, low part to lhs, high part to rhs.
+		 */
+		constexpr void wyhash_multiply(std::uint64_t& lhs, std::uint64_t& rhs) noexcept
+		{
+			#if defined(__SIZEOF_INT128__)
+			const auto result = static_cast<unsigned __int128>(lhs) * rhs;
+			lhs = static_cast<std::uint64_t>(result);
+			rhs = static_cast<std::uint64_t>(result >> 64);
+			#else
+			const std::uint64_t lhs_high = lhs >> 32;
+			const std::uint64_t rhs_high = rhs >> 32;
+			const std::uint64_t lhs_low = static_cast<std::uint32_t>(lhs);
+			const std::uint64_t rhs_low = static_cast<std::uint32_t>(rhs);
+
+			const auto high = lhs_high * rhs_high;
+			const auto middle_0 = lhs_high * rhs_low;
+			const auto middle_1 = rhs_high * lhs_low;
+			const auto low = lhs_low * rhs_low;
+
+			const auto t = low + (middle_0 << 32);
+			auto carry = static_cast<std::uint64_t>(t < low);
+			const auto result_low = t + (middle_1 << 32);
+			carry += result_low < t;
+
+			lhs = result_low;
+			rhs = high + (middle_0 >> 32) + (middle_1 >> 32) + carry;
+			#endif
+		}
+
+		[[nodiscard]] constexpr std::uint64_t wyhash_mix(std::uint64_t lhs, std::uint64_t rhs) noexcept
+		{
+			wyhash_multiply(lhs, rhs);
+			return lhs ^ rhs;
+		}
+
+		/**
+		 * @brief Read the elements as little endian bytes, a word at a time at runtime, a byte at a time in constant evaluation.
+		 */
+		template<typename T>
+		struct wyhash_reader
+		{
+			const T* data;
+
+			[[nodiscard]] constexpr std::uint64_t byte(const std::size_t index) const noexcept { return (static_cast<std::uint64_t>(static_cast<std::make_unsigned_t<T>>(data[index / sizeof(T)])) >> (8 * (index % sizeof(T)))) & 0xff; }
+
+			template<std::size_t N>
+			[[nodiscard]] constexpr std::uint64_t read(const std::size_t offset) const noexcept
+			{
+				if constexpr (std::endian::native == std::endian::little)
+				{
+					if (not std::is_constant_evaluated())
+					{
+						std::conditional_t<N == sizeof(std::uint32_t), std::uint32_t, std::uint64_t> result;
+						std::memcpy(&result, reinterpret_cast<const unsigned char*>(data) + offset, N);
+						return result;
+					}
+				}
+
+				std::uint64_t result = 0;
+				for (std::size_t i = 0; i < N; ++i) { result |= byte(offset + i) << (8 * i); }
+				return result;
+			}
+
+			[[nodiscard]] constexpr std::uint64_t read_3(const std::size_t offset, const std::size_t length) const noexcept { return (byte(offset) << 16) | (byte(offset + (length >> 1)) << 8) | byte(offset + length - 1); }
+		};
+	}
+
+	template<typename T>
+	concept hashable_string_like = std::ranges::contiguous_range<T> && std::ranges::sized_range<T> && std::is_integral_v<std::ranges::range_value_t<T>>;
+
+	/**
+	 * @brief Word-at-a-time hash. See: https://github.com/wangyi-fudan/wyhash (final version 4).
+	 *
+	 * @note The result is the same in constant evaluation and at runtime, so it can be used for compile-time names.
+	 */
+	[[nodiscard]] constexpr std::uint64_t hash_wyhash(const hashable_string_like auto& container, std::uint64_t seed = 0) noexcept
+	{
+		using namespace hash_detail;
+
+		using value_type = std::ranges::range_value_t<decltype(container)>;
+
+		const wyhash_reader<value_type> reader{std::ranges::data(container)};
+		const std::size_t length = std::ranges::size(container) * sizeof(value_type);
+
+		seed ^= wyhash_mix(seed ^ wyhash_secret[0], wyhash_secret[1]);
+
+		std::uint64_t a;
+		std::uint64_t b;
+		if (length <= 16)
+		{
+			if (length >= 4)
+			{
+				const auto offset = (length >> 3) << 2;
+				a = (reader.template read<4>(0) << 32) | reader.template read<4>(offset);
+				b = (reader.template read<4>(length - 4) << 32) | reader.template read<4>(length - 4 - offset);
+			}
+			else if (length > 0)
+			{
+				a = reader.read_3(0, length);
+				b = 0;
+			}
+			else { a = b = 0; }
+		}
+		else
+		{
+			std::size_t offset = 0;
+			std::size_t remainder = length;
+			if (remainder >= 48)
+			{
+				auto see1 = seed;
+				auto see2 = seed;
+				do
+				{
+					seed = wyhash_mix(reader.template read<8>(offset) ^ wyhash_secret[1], reader.template read<8>(offset + 8) ^ seed);
+					see1 = wyhash_mix(reader.template read<8>(offset + 16) ^ wyhash_secret[2], reader.template read<8>(offset + 24) ^ see1);
+					see2 = wyhash_mix(reader.template read<8>(offset + 32) ^ wyhash_secret[3], reader.template read<8>(offset + 40) ^ see2);
+					offset += 48;
+					remainder -= 48;
+				} while (remainder >= 48);
+				seed ^= see1 ^ see2;
+			}
+
+			while (remainder > 16)
+			{
+				seed = wyhash_mix(reader.template read<8>(offset) ^ wyhash_secret[1], reader.template read<8>(offset + 8) ^ seed);
+				offset += 16;
+				remainder -= 16;
+			}
+
+			a = reader.template read<8>(offset + remainder - 16);
+			b = reader.template read<8>(offset + remainder - 8);
+		}
+
+		a ^= wyhash_secret[1];
+		b ^= seed;
+		wyhash_multiply(a, b);
+		return wyhash_mix(a ^ wyhash_secret[0] ^ length, b ^ wyhash_secret[1]);
+	}
+
+	/**
+	 * @brief Hash an integer (or a pointer value) with the wyhash mixer.
+	 */
+	[[nodiscard]] constexpr std::uint64_t hash_wyhash(const std::uint64_t value, const std::uint64_t seed = 0) noexcept
+	{
+		using namespace hash_detail;
+
+		auto a = value ^ wyhash_secret[0];
+		auto b = seed ^ wyhash_secret[1];
+		wyhash_multiply(a, b);
+		return wyhash_mix(a ^ wyhash_secret[0], b ^ wyhash_secret[1]);
+	}
+
+	/**
+	 * @brief The default hasher of strings (string/string_view/null-terminated string), it is transparent.
+	 */
+	struct string_hasher
+	{
+		using is_transparent = int;
+
+		template<hashable_string_like String>
+			requires(not std::is_array_v<String>)
+		[[nodiscard]] constexpr std::size_t operator()(const String& string) const noexcept { return static_cast<std::size_t>(hash_wyhash(string)); }
+
+		template<typename CharType>
+			requires std::is_integral_v<CharType>
+		[[nodiscard]] constexpr std::size_t operator()(const CharType* string) const noexcept { return static_cast<std::size_t>(hash_wyhash(std::basic_string_view<CharType>{string})); }
+	};
 }
 
 #endif // GAL_UTILS_HASH_HPP
@@ -0,0 +1,141 @@
+#pragma once
+
+#ifndef GAL_UTILS_REFERENCE_COUNT_HPP
+#define GAL_UTILS_REFERENCE_COUNT_HPP
+
+/**
+ * @file reference_count.hpp
+ *
+ * @details If the compiler definition GAL_UTILS_NO_ATOMIC_REFERENCE_COUNT is defined
+ * then the shared_handle is an intrusive pointer with a non-atomic reference count instead of a std::shared_ptr.
+ * This has the result that copying a handle is faster, because no atomic operation is required. It also has the
+ * side effect that the object (and the handles to it) may not be accessed from more than one thread.
+ */
+
+#include <memory>
+#include <utility>
+
+namespace gal::utils
+{
+	/**
+	 * @brief The base of the objects owned by intrusive_ptr, the reference count lives in the object itself.
+	 * Copying (or assigning) the object does not copy its reference count.
+	 */
+	class intrusive_reference_count
+	{
+		template<typename>
+		friend class intrusive_ptr;
+
+	public:
+		using count_type = std::size_t;
+
+	private:
+		count_type count_{0};
+
+	protected:
+		constexpr intrusive_reference_count() noexcept = default;
+		constexpr intrusive_reference_count(const intrusive_reference_count&) noexcept {}
+		constexpr intrusive_reference_count& operator=(const intrusive_reference_count&) noexcept { return *this; }
+		constexpr ~intrusive_reference_count() noexcept = default;
+	};
+
+	template<typename T>
+	class intrusive_ptr
+	{
+	public:
+		using element_type = T;
+		using count_type = intrusive_reference_count::count_type;
+
+	private:
+		element_type* data_;
+
+		constexpr void retain() const noexcept { if (data_) { ++static_cast<intrusive_reference_count*>(data_)->count_; } }
+
+		constexpr void release() noexcept { if (data_ && --static_cast<intrusive_reference_count*>(data_)->count_ == 0) { delete data_; } }
+
+	public:
+		constexpr intrusive_ptr() noexcept
+			: data_{nullptr} {}
+
+		constexpr explicit intrusive_ptr(element_type* data) noexcept
+			: data_{data} { retain(); }
+
+		constexpr intrusive_ptr(const intrusive_ptr& other) noexcept
+			: data_{other.data_} { retain(); }
+
+		constexpr intrusive_ptr(intrusive_ptr&& other) noexcept
+			: data_{std::exchange(other.data_, nullptr)} {}
+
+		constexpr intrusive_ptr& operator=(const intrusive_ptr& other) noexcept
+		{
+			// retain first, other may be held by *this
+			other.retain();
+			release();
+			data_ = other.data_;
+			return *this;
+		}
+
+		constexpr intrusive_ptr& operator=(intrusive_ptr&& other) noexcept
+		{
+			if (this != &other)
+			{
+				release();
+				data_ = std::exchange(other.data_, nullptr);
+			}
+			return *this;
+		}
+
+		constexpr ~intrusive_ptr() noexcept { release(); }
+
+		constexpr void reset() noexcept
+		{
+			release();
+			data_ = nullptr;
+		}
+
+		[[nodiscard]] constexpr element_type* get() const noexcept { return data_; }
+
+		[[nodiscard]] constexpr element_type& operator*() const noexcept { return *data_; }
+
+		[[nodiscard]] constexpr element_type* operator->() const noexcept { return data_; }
+
+		[[nodiscard]] constexpr explicit operator bool() const noexcept { return data_ != nullptr; }
+
+		[[nodiscard]] constexpr count_type use_count() const noexcept { return data_ ? static_cast<const intrusive_reference_count*>(data_)->count_ : 0; }
+
+		[[nodiscard]] constexpr friend bool operator==(const intrusive_ptr& lhs, const intrusive_ptr& rhs) noexcept { return lhs.data_ == rhs.data_; }
+	};
+
+	template<typename T, typename... Args>
+	[[nodiscard]] intrusive_ptr<T> make_intrusive(Args&&... args) { return intrusive_ptr<T>{new T(std::forward<Args>(args)...)}; }
+
+	#ifndef GAL_UTILS_NO_ATOMIC_REFERENCE_COUNT
+	struct shared_handle_base { };
+
+	template<typename T>
+	using shared_handle = std::shared_ptr<T>;
+
+	template<typename T, typename... Args>
+	[[nodiscard]] shared_handle<T> make_shared_handle(Args&&... args) { return std::make_shared<T>(std::forward<Args>(args)...); }
+
+	// observes a shared_handle without keeping it alive, the intrusive handles have no weak handles
+	template<typename T>
+	using weak_handle = std::weak_ptr<T>;
+
+	// the static handles are shared by all threads
+	#define GAL_UTILS_SHARED_HANDLE_STATIC static
+	#else
+	using shared_handle_base = intrusive_reference_count;
+
+	template<typename T>
+	using shared_handle = intrusive_ptr<T>;
+
+	template<typename T, typename... Args>
+	[[nodiscard]] shared_handle<T> make_shared_handle(Args&&... args) { return make_intrusive<T>(std::forward<Args>(args)...); }
+
+	// the reference count is not atomic, each thread has its own static handles
+	#define GAL_UTILS_SHARED_HANDLE_STATIC static thread_local
+	#endif
+}
+
+#endif // GAL_UTILS_REFERENCE_COUNT_HPP
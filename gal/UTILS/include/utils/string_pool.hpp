@@ -13,7 +13,9 @@
 #include <memory>
 #include <ranges>
 #include <utils/assert.hpp>
+#include <utils/hash.hpp>
 #include <vector>
+#include <unordered_set>
 
 #ifdef GAL_UTILS_STRING_POOL_DEBUG
 #include <map>
@@ -21,7 +23,13 @@
 
 namespace gal::utils
 {
-	template<typename CharType = char, bool IsNullTerminate = true, typename CharTrait = std::char_traits<CharType>>
+	/**
+	 * @brief A pool of strings, the strings stored in it remain valid as long as the pool exists.
+	 *
+	 * @tparam IsInterning If true, the pool will deduplicate appended strings, equal strings share the same view (the same pointer).
+	 * The borrowed strings are stored in separate blocks, so returning them never moves an interned string.
+	 */
+	template<typename CharType = char, bool IsNullTerminate = true, typename CharTrait = std::char_traits<CharType>, bool IsInterning = false>
 	class string_pool
 	{
 		template<typename BlockCharType, bool BlockIsNullTerminate, typename BlockCharTrait>
@@ -110,6 +118,11 @@ namespace gal::utils
 				if constexpr (is_null_terminate) { memory_.get()[size_] = 0; }
 			}
 
+			/**
+			 * @brief The end of the used memory, the strings in [raw + size, used_end()) will be moved forward when return_raw(raw, size)
+			 */
+			[[nodiscard]] constexpr const value_type* used_end() const noexcept { return memory_.get() + size_; }
+
 			[[nodiscard]] constexpr bool storable(const view_type str) const noexcept { return available_space() >= this->length_of(str); }
 
 			[[nodiscard]] constexpr bool storable(const size_type size) const noexcept { return available_space() >= size; }
@@ -137,9 +150,17 @@ namespace gal::utils
 
 		constexpr static size_type default_capacity = 8196;
 
+		constexpr static bool is_interning = IsInterning;
+
 	private:
+		// hash index over all appended (not borrowed) strings, only used if is_interning
+		using index_type = std::unordered_set<view_type, string_hasher>;
+
 		pool_type pool_;
+		// the blocks of the borrowed strings, only used if is_interning, they are compacted when the strings are returned
+		pool_type borrowed_pool_;
 		size_type capacity_;
+		index_type index_;
 
 		using block_iterator = typename pool_type::iterator;
 
@@ -184,7 +205,7 @@ namespace gal::utils
 							{
 								auto& pool = pool_.get();
 
-								pool.return_raw_memory(pair.first, pair.second);
+								pool.return_raw_memory(pool.borrowed_blocks(), pair.first, pair.second);
 								// todo: maybe a lock is needed here?
 								// erase is not performed because the target may still have memory in use.
 								// pool.erase(pair.second);
@@ -194,6 +215,9 @@ namespace gal::utils
 
 			/**
 			 * @brief Add a string to the pool, and then you can freely use the added string.
+			 *
+			 * @note If the pool is interning and the string has already been appended to the pool, the existing view is returned and nothing is borrowed.
+			 * The borrowed strings are not interned, because they will be returned.
 			 */
 			constexpr view_type append(const view_type str)
 			{
@@ -202,10 +226,30 @@ namespace gal::utils
 				// not only to insert the string, but also to save the inserted position
 				auto& pool = pool_.get();
 
-				auto pos = pool.find_or_create_block(str);
-				return borrowed_blocks_.emplace_back(pool.append_str_into_block(str, pos), pos).first;
+				if constexpr (is_interning) { if (const auto it = pool.index_.find(str); it != pool.index_.end()) { return *it; } }
+
+				auto& blocks = pool.borrowed_blocks();
+				auto pos = pool.find_or_create_block(blocks, str.size());
+				return borrowed_blocks_.emplace_back(pool.append_str_into_block(blocks, str, pos), pos).first;
+			}
+
+			/**
+			 * @brief Find a string appended by this borrower, return an empty view if the string does not exist.
+			 *
+			 * @note Only for the borrowers which never borrow raw memory, the raw memory is compared as well.
+			 */
+			[[nodiscard]] constexpr view_type find(const view_type str) const noexcept
+			{
+				if (const auto it = std::ranges::find(borrowed_blocks_, str, [](const auto& pair) { return pair.first; });
+					it != borrowed_blocks_.end()) { return it->first; }
+				return {};
 			}
 
+			/**
+			 * @brief How many strings (and raw memory) are borrowed by this borrower.
+			 */
+			[[nodiscard]] constexpr size_type size() const noexcept { return borrowed_blocks_.size(); }
+
 			/**
 			 * @brief Borrow a block of memory to the pool, users can directly write strings in this memory area without worrying about its invalidation.
 			 */
@@ -216,13 +260,21 @@ namespace gal::utils
 				// not only to insert the string, but also to save the inserted position
 				auto& pool = pool_.get();
 
-				auto pos = pool.find_or_create_block(size);
-				return borrowed_blocks_.emplace_back({pool.borrow_raw_memory(size, pos), size}, pos).first.data();
+				auto& blocks = pool.borrowed_blocks();
+				auto pos = pool.find_or_create_block(blocks, size);
+				return borrowed_blocks_.emplace_back(view_type{pool.borrow_raw_memory(blocks, size, pos), size}, pos).first.data();
 			}
 		};
 
 	private:
-		[[nodiscard]] constexpr view_type append_str_into_block(const view_type str, block_iterator pos)
+		// the interned strings never move, the borrowed strings are stored elsewhere
+		[[nodiscard]] constexpr pool_type& borrowed_blocks() noexcept
+		{
+			if constexpr (is_interning) { return borrowed_pool_; }
+			else { return pool_; }
+		}
+
+		[[nodiscard]] constexpr view_type append_str_into_block(pool_type& blocks, const view_type str, block_iterator pos)
 		{
 			const auto ret = pos->append(str);
 
@@ -230,11 +282,11 @@ namespace gal::utils
 			debug_mapping_.emplace(ret, pos);
 			#endif
 
-			this->shake_it(pos);
+			this->shake_it(blocks, pos);
 			return ret;
 		}
 
-		[[nodiscard]] constexpr value_type* borrow_raw_memory(const size_type size, block_iterator pos)
+		[[nodiscard]] constexpr value_type* borrow_raw_memory(pool_type& blocks, const size_type size, block_iterator pos)
 		{
 			auto raw = pos->borrow_raw(size);
 
@@ -242,11 +294,11 @@ namespace gal::utils
 			debug_mapping_.emplace(view_type{raw, size}, pos);
 			#endif
 
-			this->shake_it(pos);
+			this->shake_it(blocks, pos);
 			return raw;
 		}
 
-		constexpr void return_raw_memory(const value_type* raw, const size_type size, block_iterator pos)
+		constexpr void return_raw_memory(pool_type& blocks, const value_type* raw, const size_type size, block_iterator pos)
 		{
 			pos->return_raw(raw, size);
 
@@ -254,56 +306,48 @@ namespace gal::utils
 			debug_mapping_.erase(view_type{raw, size});
 			#endif
 
-			this->shake_it(pos);
+			this->shake_it(blocks, pos);
 		}
 
-		constexpr void return_raw_memory(view_type view, block_iterator pos) { this->return_raw_memory(view.data(), view.size(), pos); }
+		constexpr void return_raw_memory(pool_type& blocks, view_type view, block_iterator pos) { this->return_raw_memory(blocks, view.data(), view.size(), pos); }
 
-		[[nodiscard]] constexpr block_iterator find_or_create_block(const size_type size)
+		[[nodiscard]] constexpr block_iterator find_or_create_block(pool_type& blocks, const size_type size)
 		{
-			if (const auto block = this->find_storable_block(size); block != pool_.end()) { return block; }
-			return this->create_storable_block(size);
+			if (const auto block = this->find_storable_block(blocks, size); block != blocks.end()) { return block; }
+			return this->create_storable_block(blocks, size);
 		}
 
-		[[nodiscard]] constexpr block_iterator find_or_create_block(const view_type str) { return this->find_or_create_block(str.size()); }
-
-		[[nodiscard]] constexpr block_iterator find_first_possible_storable_block(const size_type size) noexcept
+		[[nodiscard]] constexpr static block_iterator find_first_possible_storable_block(pool_type& blocks, const size_type size) noexcept
 		{
-			if (pool_.size() > 2 && not std::ranges::prev(pool_.end(), 2)->storable(size)) { return std::ranges::prev(pool_.end()); }
-			return pool_.begin();
+			if (blocks.size() > 2 && not std::ranges::prev(blocks.end(), 2)->storable(size)) { return std::ranges::prev(blocks.end()); }
+			return blocks.begin();
 		}
 
-		[[nodiscard]] constexpr block_iterator find_first_possible_storable_block(const view_type str) noexcept { return this->find_first_possible_storable_block(str.size()); }
-
-		[[nodiscard]] constexpr block_iterator find_storable_block(const size_type size) noexcept
+		[[nodiscard]] constexpr static block_iterator find_storable_block(pool_type& blocks, const size_type size) noexcept
 		{
 			return std::ranges::lower_bound(
-					this->find_first_possible_storable_block(size),
-					pool_.end(),
+					find_first_possible_storable_block(blocks, size),
+					blocks.end(),
 					true,
 					[](bool b, bool) { return b; },
 					[size](const auto& block) { return not block.storable(size); });
 		}
 
-		[[nodiscard]] constexpr block_iterator find_storable_block(const view_type str) noexcept { return this->find_storable_block(str.size()); }
-
-		[[nodiscard]] constexpr block_iterator create_storable_block(const size_type size)
+		[[nodiscard]] constexpr block_iterator create_storable_block(pool_type& blocks, const size_type size)
 		{
-			pool_.emplace_back(std::ranges::max(capacity_, size + IsNullTerminate));
-			return std::ranges::prev(pool_.end());
+			blocks.emplace_back(std::ranges::max(capacity_, size + IsNullTerminate));
+			return std::ranges::prev(blocks.end());
 		}
 
-		[[nodiscard]] constexpr block_iterator create_storable_block(const view_type str) { return this->create_storable_block(str.size()); }
-
-		constexpr void shake_it(block_iterator block)
+		constexpr static void shake_it(pool_type& blocks, block_iterator block)
 		{
 			if (
-				block == pool_.begin() ||
+				block == blocks.begin() ||
 				block->more_available_space_than(*std::ranges::prev(block))) { return; }
 
 			if (const auto it =
 						std::ranges::upper_bound(
-								pool_.begin(),
+								blocks.begin(),
 								block,
 								block->available_space(),
 								std::ranges::less{},
@@ -328,6 +372,9 @@ namespace gal::utils
 			  pools.pool_.clear(),
 			  std::ranges::inplace_merge(pool_.begin(), iterator, pool_.end(), [](const auto& a, const auto& b) { return not a.more_available_space_than(b); })),
 				...);
+
+			// the duplicate strings remain in the taken over blocks, but only the views we already have are used from now on
+			if constexpr (is_interning) { ((index_.merge(pools.index_), pools.index_.clear()), ...); }
 		}
 
 		template<std::same_as<string_pool>... Pools>
@@ -343,13 +390,33 @@ namespace gal::utils
 
 		/**
 		 * @brief Add a string to the pool, and then you can freely use the added string.
+		 *
+		 * @note If the pool is interning, appending an existing string returns the existing view.
 		 */
-		constexpr view_type append(const view_type str) { return this->append_str_into_block(str, this->find_or_create_block(str)); }
+		constexpr view_type append(const view_type str)
+		{
+			if constexpr (is_interning)
+			{
+				if (const auto it = index_.find(str); it != index_.end()) { return *it; }
+
+				return *index_.insert(this->append_str_into_block(pool_, str, this->find_or_create_block(pool_, str.size()))).first;
+			}
+			else { return this->append_str_into_block(pool_, str, this->find_or_create_block(pool_, str.size())); }
+		}
+
+		/**
+		 * @brief Find the existing view of the string, return an empty view if the string does not exist (or the pool is not interning).
+		 */
+		[[nodiscard]] constexpr view_type find(const view_type str) const
+		{
+			if constexpr (is_interning) { if (const auto it = index_.find(str); it != index_.end()) { return *it; } }
+			return {};
+		}
 
 		/**
 		 * @brief Borrow a block of memory to the pool, users can directly write strings in this memory area without worrying about its invalidation.
 		 */
-		[[nodiscard]] constexpr value_type* borrow_raw(const size_type size = default_capacity) { return this->borrow_raw_memory(size, this->find_or_create_block(size)); }
+		[[nodiscard]] constexpr value_type* borrow_raw(const size_type size = default_capacity) { return this->borrow_raw_memory(pool_, size, this->find_or_create_block(pool_, size)); }
 
 		/**
 		 * @brief User needs to temporarily use some memory area to store the string and return it later
@@ -358,6 +425,11 @@ namespace gal::utils
 
 		[[nodiscard]] constexpr size_type size() const noexcept { return pool_.size(); }
 
+		/**
+		 * @brief How many unique strings are interned.
+		 */
+		[[nodiscard]] constexpr size_type interned_size() const noexcept { return index_.size(); }
+
 		[[nodiscard]] constexpr size_type capacity() const noexcept { return capacity_; }
 
 		/**
@@ -0,0 +1,355 @@
+#include <gtest/gtest.h>
+
+#define GAL_LANG_NO_RECODE_CALL_LOCATION_DEBUG
+#define GAL_LANG_NO_AST_VISIT_PRINT
+#include <gal/gal.hpp>
+
+using namespace gal::lang;
+
+namespace
+{
+	[[nodiscard]] bool has_last_use(const ast::ast_node& node)
+	{
+		return node.is<ast::last_use_id_ast_node>() || std::ranges::any_of(node.view(), [](const auto& child) { return has_last_use(child); });
+	}
+}
+
+TEST(TestAstOptimizer, TestInlineCall)
+{
+	engine e{};
+
+	const auto result = e.eval(R"(
+		def square(x) { x * x }
+		def add(a, b) { return a + b; }
+		add(square(3), square(4))
+	)");
+
+	ASSERT_EQ(e.boxed_cast<int>(result), 25);
+}
+
+TEST(TestAstOptimizer, TestInlineCallFallback)
+{
+	engine e{};
+
+	(void)e.eval(R"(
+		def twice(x) { x * 2 }
+		def call_twice(x) { twice(x) }
+	)");
+	ASSERT_EQ(e.boxed_cast<int>(e.eval("call_twice(21)")), 42);
+
+	// the overload set changes, the inlined call has to dispatch again
+	(void)e.eval(R"(def twice(x, y) { x * y })");
+	ASSERT_EQ(e.boxed_cast<int>(e.eval("call_twice(21)")), 42);
+}
+
+TEST(TestAstOptimizer, TestInlineCallShadowed)
+{
+	engine e{};
+
+	// the name is shadowed by a local variable
+	const auto result = e.eval(R"(
+		def twice(x) { x * 2 }
+		def twice_local(x)
+		{
+			var twice = fun(y) { y * 3 };
+			twice(x)
+		}
+		twice_local(2)
+	)");
+
+	ASSERT_EQ(e.boxed_cast<int>(result), 6);
+}
+
+TEST(TestAstOptimizer, TestInlineCallCallerFrame)
+{
+	engine e{};
+
+	// only the bodies that refer to nothing but their parameters and locals are inlined
+	const auto node = e.parse(R"(
+		def square(x) { var y = x; y * x }
+		def offset(x) { x + base }
+		square(3) + offset(1)
+	)");
+	const auto& call = node->back();
+	ASSERT_TRUE(call.get_child(0).is<ast::inline_call_ast_node>());
+	ASSERT_FALSE(call.get_child(1).is<ast::inline_call_ast_node>());
+
+	// the inlined body does not see the locals of the caller
+	ASSERT_EQ(e.boxed_cast<int>(e.eval(R"(
+		def cube(x) { var y = x * x; y * x }
+		var x = 100;
+		var y = 100;
+		cube(3) + x + y
+	)")), 227);
+}
+
+TEST(TestAstOptimizer, TestInlineCallMixed)
+{
+	engine e{};
+
+	// the same body is evaluated inline and through a function value, both must bind the locals in the same slots
+	const auto node = e.parse(R"(
+		def diff(a, b) { var s = a - b; s * 2 }
+		diff(10, 3)
+	)");
+	ASSERT_TRUE(node->back().is<ast::inline_call_ast_node>());
+	ASSERT_EQ(e.boxed_cast<int>(e.eval(*node)), 14);
+
+	// inlined first
+	ASSERT_EQ(e.boxed_cast<int>(e.eval(R"(
+		var g = diff;
+		g(20, 5)
+	)")), 30);
+	ASSERT_EQ(e.boxed_cast<int>(e.eval("diff(7, 4)")), 6);
+
+	// called through a function value first
+	ASSERT_EQ(e.boxed_cast<int>(e.eval(R"(
+		def sum(a, b) { var s = a + b; s * 3 }
+		var h = sum;
+		var x = h(1, 2);
+		var y = sum(3, 4);
+		var z = h(5, 6);
+		x * 10000 + y * 100 + z
+	)")), 92133);
+}
+
+TEST(TestAstOptimizer, TestConstantPropagation)
+{
+	engine e{};
+
+	// the branch is resolved when parsing
+	const auto node = e.parse(R"(
+		var debug = false;
+		var level = 2;
+		if (debug || level > 3) { print("verbose"); } else { level * 10 }
+	)");
+	ASSERT_FALSE(std::ranges::any_of(node->view(), [](const auto& child) { return child.template is<ast::if_ast_node>(); }));
+
+	ASSERT_EQ(e.boxed_cast<int>(e.eval(R"(
+		var level = 2;
+		if (level > 3) { 1 } else { level * 10 }
+	)")), 20);
+
+	// reassigned, not a constant
+	ASSERT_EQ(e.boxed_cast<int>(e.eval(R"(
+		var count = 1;
+		count = 5;
+		if (count > 3) { count } else { 0 }
+	)")), 5);
+}
+
+TEST(TestAstOptimizer, TestConstGlobalPropagation)
+{
+	engine e{};
+	e.add_global_immutable("feature_enabled", const_var(true));
+
+	const auto node = e.parse(R"(if (feature_enabled) { 1 } else { 2 })");
+	ASSERT_FALSE(std::ranges::any_of(node->view(), [](const auto& child) { return child.template is<ast::if_ast_node>(); }));
+
+	ASSERT_EQ(e.boxed_cast<int>(e.eval(R"(if (feature_enabled) { 1 } else { 2 })")), 1);
+
+	// shadowed by a local variable
+	ASSERT_EQ(e.boxed_cast<int>(e.eval(R"(
+		def check(feature_enabled) { if (feature_enabled) { 1 } else { 2 } }
+		check(false)
+	)")), 2);
+}
+
+TEST(TestAstOptimizer, TestConstGlobalReassigned)
+{
+	engine e{};
+	e.add_global("verbose", const_var(true));
+
+	// not registered as immutable, it is looked up at runtime
+	const auto node = e.parse(R"(if (verbose) { 1 } else { 2 })");
+	ASSERT_TRUE(std::ranges::any_of(node->view(), [](const auto& child) { return child.template is<ast::if_ast_node>(); }));
+
+	e.global_assign_or_insert("verbose", const_var(false));
+	ASSERT_EQ(e.boxed_cast<int>(e.eval(R"(if (verbose) { 1 } else { 2 })")), 2);
+
+	e.add_global_immutable("feature_enabled", const_var(true));
+	ASSERT_THROW(e.global_assign_or_insert("feature_enabled", const_var(false)), exception::global_immutable_error);
+
+	// a local declared by a previous script hides the immutable global
+	(void)e.eval(R"(var feature_enabled = false;)");
+	ASSERT_EQ(e.boxed_cast<int>(e.eval(R"(if (feature_enabled) { 1 } else { 2 })")), 2);
+}
+
+TEST(TestAstOptimizer, TestLoopInvariant)
+{
+	engine e{};
+
+	const auto contains_invariant = [](const auto& self, const ast::ast_node& node) -> bool
+	{
+		return node.is<ast::loop_invariant_ast_node>() || std::ranges::any_of(node.view(), [&self](const auto& child) { return self(self, child); });
+	};
+
+	// 'l.size()' is evaluated once
+	const auto node = e.parse(R"(
+		var l = [1, 2, 3];
+		var i = 0;
+		while (i < l.size()) { ++i; }
+	)");
+	ASSERT_TRUE(contains_invariant(contains_invariant, *node));
+
+	ASSERT_EQ(e.boxed_cast<int>(e.eval(R"(
+		var l = [1, 2, 3];
+		var i = 0;
+		var sum = 0;
+		while (i < l.size()) { sum += l[i]; ++i; }
+		sum
+	)")), 6);
+
+	// the list grows in the loop, its size is evaluated each time
+	ASSERT_EQ(e.boxed_cast<std::size_t>(e.eval(R"(
+		var l = [1];
+		var i = 0;
+		while (i < l.size() && i < 5) { l.push_back(i); ++i; }
+		l.size()
+	)")), 6);
+
+	// the script function may modify anything
+	ASSERT_EQ(e.boxed_cast<std::size_t>(e.eval(R"(
+		var l = [1];
+		def grow(x) { x.push_back(0); }
+		var i = 0;
+		while (i < l.size() && i < 5) { grow(l); ++i; }
+		l.size()
+	)")), 6);
+
+	// 'd[key]' inserts the key, the size is evaluated each time
+	ASSERT_EQ(e.boxed_cast<std::size_t>(e.eval(R"(
+		var d = ["0": 0];
+		var i = 1;
+		while (d.size() < 5 && i < 10) { d[to_string(i)]; ++i; }
+		d.size()
+	)")), 5u);
+}
+
+TEST(TestAstOptimizer, TestLoopInvariantGlobal)
+{
+	engine e{};
+
+	// the native function does not call the scripts, but it modifies a global object shared with the host
+	int limit = 3;
+	e.add_global_mutable("limit", var(std::ref(limit)));
+	e.add_function("bump", fun([&limit] { ++limit; }), foundation::function_attribute::no_script_callback);
+
+	ASSERT_EQ(e.boxed_cast<int>(e.eval(R"(
+		var i = 0;
+		while (i < limit + 0 && i < 10) { bump(); ++i; }
+		i
+	)")), 10);
+}
+
+TEST(TestAstOptimizer, TestPureCallFolding)
+{
+	engine e{};
+
+	int calls = 0;
+	e.add_function("twice", fun([&calls](const int i) { ++calls; return i * 2; }), foundation::function_attribute::pure | foundation::function_attribute::const_result);
+	e.add_function("twice_unknown", fun([&calls](const int i) { ++calls; return i * 2; }));
+
+	const auto is_constant = [](const ast::ast_node& node) { return node.is<ast::constant_ast_node>(); };
+
+	// called once at parse time
+	ASSERT_TRUE(std::ranges::all_of(e.parse(R"(twice(21))")->view(), is_constant));
+	ASSERT_EQ(calls, 1);
+
+	// not annotated, called at runtime
+	ASSERT_FALSE(std::ranges::all_of(e.parse(R"(twice_unknown(21))")->view(), is_constant));
+	ASSERT_EQ(calls, 1);
+
+	// the builtin operators of the strings
+	ASSERT_TRUE(std::ranges::all_of(e.parse(R"("ab" + "c" == "abc")")->view(), is_constant));
+	ASSERT_TRUE(e.boxed_cast<bool>(e.eval(R"("ab" + "c" == "abc")")));
+	ASSERT_EQ(e.boxed_cast<std::size_t>(e.eval(R"("abc".size())")), 3);
+
+	// overloaded by a script function, the overload is resolved at runtime
+	ASSERT_FALSE(std::ranges::any_of(e.parse(R"(
+		def twice(string x) { x + x }
+		twice(21)
+	)")->view(), is_constant));
+	ASSERT_EQ(calls, 1);
+}
+
+TEST(TestAstOptimizer, TestLastUse)
+{
+	engine e{};
+
+	// the list is moved into 'copy', it is not read again
+	ASSERT_TRUE(has_last_use(*e.parse(R"({
+		var list = [1];
+		list.push_back(2);
+		var copy = list;
+		copy.size()
+	})")));
+
+	// the list escapes into 'kept', it has to be cloned
+	ASSERT_FALSE(has_last_use(*e.parse(R"(
+		var kept = [];
+		{
+			var list = [1];
+			kept.push_back(list);
+			var copy = list;
+			copy.size()
+		}
+	)")));
+
+	// 'b := a' makes 'b' share the list of 'a', it has to be cloned
+	ASSERT_FALSE(has_last_use(*e.parse(R"({
+		var a = [1];
+		var b = [];
+		b := a;
+		var c = b;
+		c.push_back(2);
+		a.size()
+	})")));
+	ASSERT_EQ(e.boxed_cast<std::size_t>(e.eval(R"({
+		var a = [1];
+		var b = [];
+		b := a;
+		var c = b;
+		c.push_back(2);
+		a.size()
+	})")), 1u);
+
+	// the result of the function is taken by the caller
+	ASSERT_EQ(e.boxed_cast<std::size_t>(e.eval(R"(
+		def make(n)
+		{
+			var list = [];
+			var i = 0;
+			while (i < n) { list.push_back(i); ++i; }
+			return list;
+		}
+		var result = make(3);
+		result.size()
+	)")), 3u);
+
+	ASSERT_EQ(e.boxed_cast<std::size_t>(e.eval(R"(
+		var kept = [];
+		{
+			var list = [1];
+			kept.push_back(list);
+			var copy = list;
+			copy.push_back(2);
+		}
+		kept[0].size()
+	)")), 1u);
+
+	// the variable refers to a host object, it has to be cloned
+	types::list_type host{};
+	host.push_back(var(1));
+	e.add_function("host_list", fun([&host]() -> types::list_type& { return host; }));
+
+	const auto node = e.parse(R"({
+		var d = host_list();
+		var x = d;
+		x.push_back(2);
+		x.size()
+	})");
+	ASSERT_TRUE(has_last_use(*node));
+	ASSERT_EQ(e.boxed_cast<std::size_t>(e.eval(*node)), 2u);
+	ASSERT_EQ(host.size(), 1u);
+}
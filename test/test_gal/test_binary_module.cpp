@@ -0,0 +1,32 @@
+#include <gtest/gtest.h>
+
+#define GAL_LANG_NO_RECODE_CALL_LOCATION_DEBUG
+#define GAL_LANG_NO_AST_VISIT_PRINT
+#include <gal/foundation/engine.hpp>
+
+using namespace gal::lang;
+
+TEST(TestBinaryModule, TestLoad)
+{
+	const plugin::binary_module m{"test_module", GAL_TEST_MODULE_PATH};
+
+	ASSERT_NE(m.module_ptr, nullptr);
+}
+
+TEST(TestBinaryModule, TestLoadTwice)
+{
+	// the library is reference counted by the loader, the second one shares the handle
+	const plugin::binary_module m1{"test_module", GAL_TEST_MODULE_PATH};
+	const plugin::binary_module m2{"test_module", GAL_TEST_MODULE_PATH};
+
+	ASSERT_EQ(m1.function.symbol, m2.function.symbol);
+	ASSERT_NE(m1.module_ptr, m2.module_ptr);
+}
+
+TEST(TestBinaryModule, TestBadModule)
+{
+	// no such file
+	ASSERT_THROW((plugin::binary_module{"test_module", "this_module_does_not_exist"}), exception::load_module_error);
+	// no such entry point
+	ASSERT_THROW((plugin::binary_module{"not_a_module", GAL_TEST_MODULE_PATH}), exception::load_module_error);
+}
@@ -0,0 +1,138 @@
+#include <gtest/gtest.h>
+
+#define GAL_LANG_NO_RECODE_CALL_LOCATION_DEBUG
+#define GAL_LANG_NO_AST_VISIT_PRINT
+#include <gal/gal.hpp>
+
+using namespace gal::lang;
+
+namespace
+{
+	[[nodiscard]] const ast::constant_match_ast_node* find_match(const ast::ast_node& node)
+	{
+		if (node.is<ast::constant_match_ast_node>()) { return dynamic_cast<const ast::constant_match_ast_node*>(&node); }
+
+		for (const auto& child: node.view()) { if (const auto* result = find_match(child)) { return result; } }
+		return nullptr;
+	}
+}
+
+TEST(TestConstantMatch, TestDense)
+{
+	engine e{};
+
+	// without 'break' the next case is evaluated too
+	const auto node = e.parse(R"(
+		def classify(x) {
+			var r = 0;
+			match (x) {
+				=> 1 { r = 10; break; }
+				=> 2 { r = 20; }
+				=> 3 { r += 1; break; }
+				=> 4 { r = 40; pass; }
+				=> 5 { r += 5; break; }
+				_ { r = -1; }
+			}
+			r
+		}
+	)");
+	(void)e.eval(*node);
+
+	const auto* match = find_match(*node);
+	ASSERT_NE(match, nullptr);
+	ASSERT_TRUE(match->is_dense());
+
+	ASSERT_EQ(e.boxed_cast<int>(e.eval("classify(1)")), 10);
+	ASSERT_EQ(e.boxed_cast<int>(e.eval("classify(2)")), 21);
+	ASSERT_EQ(e.boxed_cast<int>(e.eval("classify(3)")), 1);
+	// 'pass' falls through
+	ASSERT_EQ(e.boxed_cast<int>(e.eval("classify(4)")), 45);
+	// out of the table
+	ASSERT_EQ(e.boxed_cast<int>(e.eval("classify(0)")), -1);
+	ASSERT_EQ(e.boxed_cast<int>(e.eval("classify(6)")), -1);
+	// not an integral value, compared case by case
+	ASSERT_EQ(e.boxed_cast<int>(e.eval("classify(1.0)")), 10);
+	ASSERT_EQ(e.boxed_cast<int>(e.eval("classify(2.5)")), -1);
+}
+
+TEST(TestConstantMatch, TestHashed)
+{
+	engine e{};
+
+	const auto node = e.parse(R"(
+		def classify(x) {
+			var r = 0;
+			match (x) {
+				=> 1 { r = 1; break; }
+				=> 1000 { r = 2; }
+				=> 1000000 { r += 3; break; }
+				=> 1 { r = 4; break; }
+			}
+			r
+		}
+	)");
+	(void)e.eval(*node);
+
+	const auto* match = find_match(*node);
+	ASSERT_NE(match, nullptr);
+	ASSERT_FALSE(match->is_dense());
+
+	// the first case of the same value is matched
+	ASSERT_EQ(e.boxed_cast<int>(e.eval("classify(1)")), 1);
+	ASSERT_EQ(e.boxed_cast<int>(e.eval("classify(1000)")), 5);
+	ASSERT_EQ(e.boxed_cast<int>(e.eval("classify(1000000)")), 3);
+	// no case matched and no default case
+	ASSERT_EQ(e.boxed_cast<int>(e.eval("classify(2)")), 0);
+}
+
+TEST(TestConstantMatch, TestString)
+{
+	engine e{};
+
+	const auto node = e.parse(R"(
+		def classify(x) {
+			var r = 0;
+			match (x) {
+				=> "a" { r = 1; break; }
+				=> "b" { r = 2; }
+				_ { r += 10; }
+			}
+			r
+		}
+	)");
+	(void)e.eval(*node);
+
+	const auto* match = find_match(*node);
+	ASSERT_NE(match, nullptr);
+	ASSERT_FALSE(match->is_dense());
+
+	ASSERT_EQ(e.boxed_cast<int>(e.eval(R"(classify("a"))")), 1);
+	// falls through into the default case
+	ASSERT_EQ(e.boxed_cast<int>(e.eval(R"(classify("b"))")), 12);
+	ASSERT_EQ(e.boxed_cast<int>(e.eval(R"(classify("c"))")), 10);
+}
+
+TEST(TestConstantMatch, TestDefaultFirst)
+{
+	engine e{};
+
+	// the cases after the default case are only reached by falling through
+	const auto node = e.parse(R"(
+		def classify(x) {
+			var r = 0;
+			match (x) {
+				=> 1 { r = 1; break; }
+				_ { r = -1; }
+				=> 2 { r = 2; break; }
+			}
+			r
+		}
+	)");
+	(void)e.eval(*node);
+
+	ASSERT_NE(find_match(*node), nullptr);
+
+	ASSERT_EQ(e.boxed_cast<int>(e.eval("classify(1)")), 1);
+	ASSERT_EQ(e.boxed_cast<int>(e.eval("classify(2)")), -1);
+	ASSERT_EQ(e.boxed_cast<int>(e.eval("classify(3)")), -1);
+}
@@ -0,0 +1,66 @@
+#include <gtest/gtest.h>
+
+#define GAL_LANG_NO_RECODE_CALL_LOCATION_DEBUG
+#define GAL_LANG_NO_AST_VISIT_PRINT
+#include <gal/gal.hpp>
+
+using namespace gal::lang;
+
+TEST(TestCopyOnWrite, TestList)
+{
+	types::list_type list{foundation::parameters_type{const_var(1), const_var(2)}};
+
+	auto copy = list;
+	copy.push_back(const_var(3));
+
+	ASSERT_EQ(list.size(), 2u);
+	ASSERT_EQ(copy.size(), 3u);
+	ASSERT_EQ(boxed_cast<int>(copy.front()), 1);
+}
+
+TEST(TestCopyOnWrite, TestDict)
+{
+	types::dict_type dict{};
+	dict.emplace(types::dict_type::key_type{foundation::string_view_type{"key"}}, const_var(1));
+
+	const auto copy = dict;
+	dict.erase_at(types::dict_type::key_type{foundation::string_view_type{"key"}});
+
+	ASSERT_TRUE(dict.empty());
+	ASSERT_EQ(boxed_cast<int>(copy.get(types::dict_type::key_type{foundation::string_view_type{"key"}})), 1);
+}
+
+TEST(TestCopyOnWrite, TestScript)
+{
+	engine e{};
+
+	// the copy is modified, the original is not
+	(void)e.eval(R"(
+		var list = [1, 2, 3];
+		var copy = list;
+		copy.push_back(4);
+	)");
+
+	ASSERT_EQ(e.boxed_cast<std::size_t>(e.eval("list.size()")), 3u);
+	ASSERT_EQ(e.boxed_cast<std::size_t>(e.eval("copy.size()")), 4u);
+}
+
+TEST(TestCopyOnWrite, TestModifiedWhileIterating)
+{
+	engine e{};
+
+	// the loop keeps the storage it started with alive, the first write detaches the list
+	ASSERT_EQ(e.boxed_cast<int>(e.eval(R"(
+		var l = [1, 2, 3];
+		var sum = 0;
+		for (var x in l)
+		{
+			var c = l;
+			l.push_back(0);
+			c.clear();
+			sum += x;
+		}
+		sum
+	)")), 6);
+	ASSERT_EQ(e.boxed_cast<std::size_t>(e.eval("l.size()")), 6u);
+}
@@ -0,0 +1,112 @@
+#include <gtest/gtest.h>
+
+#define GAL_LANG_NO_RECODE_CALL_LOCATION_DEBUG
+#define GAL_LANG_NO_AST_VISIT_PRINT
+#include <gal/gal.hpp>
+
+using namespace gal::lang;
+
+namespace
+{
+	[[nodiscard]] bool has_counted_for(const ast::ast_node& node)
+	{
+		return node.is<ast::counted_for_ast_node>() || std::ranges::any_of(node.view(), [](const auto& child) { return has_counted_for(child); });
+	}
+}
+
+TEST(TestCountedFor, TestCountedFor)
+{
+	engine e{};
+
+	const auto node = e.parse(R"(
+		var sum = 0;
+		for (var i in range(0, 10)) { sum += i; }
+		sum == 45
+	)");
+	ASSERT_TRUE(has_counted_for(*node));
+	ASSERT_TRUE(e.boxed_cast<bool>(e.eval(*node)));
+
+	// the loop variable held by someone else is not modified in place
+	ASSERT_TRUE(e.boxed_cast<bool>(e.eval(R"(
+		var l = [];
+		for (var i in range(0, 3)) { l.push_back(i); }
+		l[0] == 0 && l[1] == 1 && l[2] == 2
+	)")));
+
+	// the body declares locals in each iteration
+	ASSERT_TRUE(e.boxed_cast<bool>(e.eval(R"(
+		var sum = 0;
+		for (var i in range(0, 3)) { var a = i; var b = a * 2; var c = b + 1; sum += c; }
+		sum == 9
+	)")));
+}
+
+TEST(TestCountedFor, TestStep)
+{
+	engine e{};
+
+	// the counted loop and the plain ranged for (over a range object) agree
+	const auto check = [&e](const std::string_view range, const int expected_count, const int expected_sum)
+	{
+		const auto counted = std_format::format(R"(var count = 0; var sum = 0; for (var i in {}) {{ ++count; sum += i; }} count == {} && sum == {})", range, expected_count, expected_sum);
+		const auto ranged = std_format::format(R"(var count = 0; var sum = 0; var r = {}; for (var i in r) {{ ++count; sum += i; }} count == {} && sum == {})", range, expected_count, expected_sum);
+
+		return e.boxed_cast<bool>(e.eval(counted)) && e.boxed_cast<bool>(e.eval(ranged));
+	};
+
+	ASSERT_TRUE(check("range(0, 10, 3)", 4, 18));
+	ASSERT_TRUE(check("range(10, 0, -3)", 4, 22));
+	ASSERT_TRUE(check("range(0, -5, -1)", 5, -10));
+	// a zero step makes the range empty
+	ASSERT_TRUE(check("range(0, 10, 0)", 0, 0));
+	// the step goes away from the end
+	ASSERT_TRUE(check("range(0, 10, -1)", 0, 0));
+	ASSERT_TRUE(check("range(10, 0, 1)", 0, 0));
+	ASSERT_TRUE(check("range(5, 5)", 0, 0));
+}
+
+TEST(TestCountedFor, TestBreakContinue)
+{
+	engine e{};
+
+	// 'pass' continues with the next iteration
+	const auto check = [&e](const std::string_view range)
+	{
+		return e.boxed_cast<bool>(e.eval(std_format::format(R"(
+			var sum = 0;
+			var r = {};
+			for (var i in r) {{
+				if (i == 7) {{ break; }}
+				if (i % 2 == 0) {{ pass; }}
+				sum += i;
+			}}
+			sum == 15
+		)", range)));
+	};
+
+	// counted
+	ASSERT_TRUE(e.boxed_cast<bool>(e.eval(R"(
+		var sum = 0;
+		for (var i in range(0, 10)) {
+			if (i == 7) { break; }
+			if (i % 2 == 0) { pass; }
+			sum += i;
+		}
+		sum == 15
+	)")));
+	// ranged for over a range object and over a container
+	ASSERT_TRUE(check("range(0, 10)"));
+	ASSERT_TRUE(check("[0, 1, 2, 3, 4, 5, 6, 7, 8, 9]"));
+
+	// the inner break only leaves the inner loop
+	ASSERT_TRUE(e.boxed_cast<bool>(e.eval(R"(
+		var count = 0;
+		for (var i in range(0, 3)) {
+			for (var j in range(0, 10)) {
+				if (j == 2) { break; }
+				++count;
+			}
+		}
+		count == 6
+	)")));
+}
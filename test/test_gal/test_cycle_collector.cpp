@@ -0,0 +1,81 @@
+#include <gtest/gtest.h>
+
+#define GAL_LANG_NO_RECODE_CALL_LOCATION_DEBUG
+#define GAL_LANG_NO_AST_VISIT_PRINT
+#include <gal/gal.hpp>
+
+using namespace gal::lang;
+
+TEST(TestCycleCollector, TestList)
+{
+	foundation::cycle_collector collector{};
+	// the garbage of the previous tests
+	(void)collector.collect();
+
+	{
+		foundation::boxed_value list{types::list_type{}};
+		boxed_cast<types::list_type&>(list).push_back(list);
+	}
+
+	foundation::boxed_value live{types::list_type{}};
+	boxed_cast<types::list_type&>(live).push_back(live);
+
+	const auto result = collector.collect();
+	ASSERT_EQ(result.objects, 1u);
+	ASSERT_GT(result.bytes, 0u);
+	ASSERT_EQ(boxed_cast<const types::list_type&>(live).size(), 1u);
+
+	boxed_cast<types::list_type&>(live).clear();
+}
+
+TEST(TestCycleCollector, TestIncremental)
+{
+	foundation::cycle_collector collector{};
+	(void)collector.collect();
+
+	{
+		foundation::boxed_value dict{types::dict_type{}};
+		foundation::boxed_value object{foundation::dynamic_object{"cycle"}};
+
+		boxed_cast<types::dict_type&>(dict).get(types::dict_type::key_type{foundation::string_view_type{"object"}}) = object;
+		boxed_cast<foundation::dynamic_object&>(object).set_attr("dict", dict);
+	}
+
+	foundation::cycle_collector::size_type objects = 0;
+	for (auto i = 0; i < 1000 && objects < 2; ++i) { objects += collector.collect(2).objects; }
+
+	ASSERT_EQ(objects, 2u);
+}
+
+TEST(TestCycleCollector, TestScript)
+{
+	engine e{};
+	(void)e.collect();
+
+	(void)e.eval(R"(
+		{
+			var a = [];
+			var b = ["b"];
+			a.push_back(b);
+			b.push_back(a);
+		}
+	)");
+
+	ASSERT_EQ(e.collect().objects, 2u);
+}
+
+TEST(TestCycleCollector, TestReassign)
+{
+	engine e{};
+	(void)e.collect();
+
+	// 'x' is tracked once, not once per assignment
+	const auto before = foundation::cycle_collector::tracked();
+	(void)e.eval(R"(
+		var l = [];
+		var x = [];
+		var i = 0;
+		while (i < 1000) { x := l; ++i; }
+	)");
+	ASSERT_LT(foundation::cycle_collector::tracked(), before + 100);
+}
@@ -0,0 +1,181 @@
+#include <gtest/gtest.h>
+
+#define GAL_LANG_NO_RECODE_CALL_LOCATION_DEBUG
+#define GAL_LANG_NO_AST_VISIT_PRINT
+#include <gal/gal.hpp>
+
+using namespace gal::lang;
+
+TEST(TestFunctionHandle, TestScriptFunction)
+{
+	engine e{};
+
+	(void)e.eval("def add(x, y) { x + y }");
+
+	const auto add = e.get_function<int(int, int)>("add");
+	ASSERT_EQ(add.name(), "add");
+	ASSERT_EQ(add(1, 2), 3);
+	ASSERT_EQ(add(-5, 5), 0);
+
+	// the result is converted to the requested type
+	const auto add_double = e.get_function<double(double, double)>("add");
+	ASSERT_DOUBLE_EQ(add_double(1.5, 2.25), 3.75);
+
+	// the overload set changes, the handle resolves it again
+	(void)e.eval("def add(x, y, z) { x + y + z }");
+	ASSERT_EQ(add(1, 2), 3);
+	ASSERT_EQ(e.get_function<int(int, int, int)>("add")(1, 2, 3), 6);
+}
+
+TEST(TestFunctionHandle, TestNativeFunction)
+{
+	engine e{};
+
+	int calls = 0;
+	e.add_function("scale", fun([&calls](const int value, const int factor) { ++calls; return value * factor; }));
+
+	const auto scale = e.get_function<int(int, int)>("scale");
+	ASSERT_EQ(scale(3, 4), 12);
+	ASSERT_EQ(scale(-2, 8), -16);
+	ASSERT_EQ(calls, 2);
+
+	// the reference argument is passed without copy
+	e.add_function("increase", fun([](int& value) { ++value; }));
+
+	int value = 41;
+	e.get_function<void(int&)>("increase")(value);
+	ASSERT_EQ(value, 42);
+}
+
+TEST(TestFunctionHandle, TestMismatch)
+{
+	engine e{};
+
+	(void)e.eval("def twice(string x) { x + x }");
+	(void)e.eval("def one(x) { x }");
+
+	// no overload accepts the argument, the dispatcher rejects it
+	ASSERT_THROW((void)e.get_function<foundation::boxed_value(int)>("twice")(42), exception::dispatch_error);
+	// wrong arity
+	ASSERT_THROW((void)e.get_function<foundation::boxed_value(int, int)>("one")(1, 2), exception::dispatch_error);
+	ASSERT_THROW((void)e.get_function<foundation::boxed_value()>("one")(), exception::dispatch_error);
+	// no such function
+	ASSERT_THROW((void)e.get_function<foundation::boxed_value(int)>("nothing")(1), exception::dispatch_error);
+
+	// the result cannot be converted to the requested type
+	ASSERT_THROW((void)e.get_function<int(const types::string_type&)>("one")(types::string_type{foundation::string_view_type{"x"}}), exception::bad_boxed_cast);
+
+	// the guard may reject the arguments, the handle dispatches the call
+	(void)e.eval("def sign(x) requires x < 0 { -1 }");
+	(void)e.eval("def sign(x) { 1 }");
+	const auto sign = e.get_function<int(int)>("sign");
+	ASSERT_EQ(sign(-3), -1);
+	ASSERT_EQ(sign(3), 1);
+}
+
+TEST(TestFunctionHandle, TestConvertedArgument)
+{
+	engine e{};
+
+	(void)e.eval("def twice(string x) { x + x }");
+
+	// std::string is not the type of the parameter (the overload is not called directly), the dispatcher converts it
+	const auto twice = e.get_function<types::string_type(const std::string&)>("twice");
+
+	const std::string s{"ab"};
+	ASSERT_EQ(twice(s).data(), "abab");
+	ASSERT_EQ(twice("xyz").data(), "xyzxyz");
+
+	// the script string type is passed directly
+	ASSERT_EQ(e.get_function<types::string_type(const types::string_type&)>("twice")(types::string_type{foundation::string_view_type{"c"}}).data(), "cc");
+}
+
+TEST(TestFunctionHandle, TestCallBatch)
+{
+	engine e{};
+
+	(void)e.eval("def score(x, y) { x * 10 + y }");
+
+	const auto score = e.get_function<int(int, int)>("score");
+
+	const std::vector xs{1, 2, 3, 4, 5};
+	const std::vector ys{5, 4, 3, 2, 1};
+
+	// the same results as the calls one by one
+	std::vector<int> results(xs.size());
+	score.call_batch(std::span{results}, std::span{xs}, std::span{ys});
+	for (std::size_t i = 0; i < xs.size(); ++i) { ASSERT_EQ(results[i], score(xs[i], ys[i])); }
+
+	// through the engine
+	std::vector<int> engine_results(xs.size());
+	e.call_batch(score, std::span{engine_results}, std::span{xs}, std::span{ys});
+	ASSERT_EQ(engine_results, results);
+
+	// the output may be shorter than the inputs, but not the other way around
+	std::vector<int> shorter(2);
+	score.call_batch(std::span{shorter}, std::span{xs}, std::span{ys});
+	ASSERT_EQ(shorter[1], results[1]);
+	ASSERT_THROW(score.call_batch(std::span{results}, std::span{xs}, std::span{ys}.first(3)), std::out_of_range);
+
+	// the reference arguments are passed as they are
+	e.add_function("increase", fun([](int& value) { ++value; }));
+	std::vector values{1, 2, 3};
+	e.get_function<void(int&)>("increase").call_batch(std::span{values});
+	ASSERT_EQ(values, (std::vector{2, 3, 4}));
+}
+
+TEST(TestFunctionHandle, TestCallBatchEmpty)
+{
+	engine e{};
+
+	int calls = 0;
+	e.add_function("counted", fun([&calls](const int value) { ++calls; return value; }));
+
+	const auto counted = e.get_function<int(int)>("counted");
+
+	std::vector<int> results{};
+	const std::vector<int> inputs{};
+	counted.call_batch(std::span{results}, std::span{inputs});
+	ASSERT_EQ(calls, 0);
+
+	// the inputs are not touched at all
+	const std::vector more{1, 2};
+	counted.call_batch(std::span{results}, std::span{more});
+	ASSERT_EQ(calls, 0);
+}
+
+TEST(TestFunctionHandle, TestCallBatchThrow)
+{
+	engine e{};
+
+	e.add_function(
+			"check",
+			fun([](const int value)
+			{
+				if (value == 3) { throw std::runtime_error{"bad value"}; }
+				return value * 2;
+			}));
+	(void)e.eval("def checked(x) { check(x) + 1 }");
+
+	for (const auto name: {"check", "checked"})
+	{
+		const auto handle = e.get_function<int(int)>(name);
+
+		const std::vector inputs{1, 2, 3, 4};
+		std::vector results(inputs.size(), -1);
+
+		// the results before the failed call are written, the later ones are not
+		ASSERT_ANY_THROW(handle.call_batch(std::span{results}, std::span{inputs}));
+		ASSERT_EQ(results[0], handle(1));
+		ASSERT_EQ(results[1], handle(2));
+		ASSERT_EQ(results[2], -1);
+		ASSERT_EQ(results[3], -1);
+
+		// the handle (and the engine) can still be used
+		std::vector<int> again(2);
+		handle.call_batch(std::span{again}, std::span{inputs});
+		ASSERT_EQ(again[0], results[0]);
+		ASSERT_EQ(again[1], results[1]);
+		ASSERT_EQ(e.boxed_cast<int>(e.eval("checked(5)")), 11);
+	}
+}
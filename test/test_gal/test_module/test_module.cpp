@@ -0,0 +1,24 @@
+#define GAL_LANG_NO_RECODE_CALL_LOCATION_DEBUG
+#define GAL_LANG_NO_AST_VISIT_PRINT
+#include <gal/defines.hpp>
+#include <gal/function_register.hpp>
+
+namespace
+{
+	int test_module_add(const int lhs, const int rhs) { return lhs + rhs; }
+
+	int test_module_square(const int value) { return value * value; }
+}
+
+/**
+ * @brief The entry point looked up by binary_module, the symbol name is binary_module::module_load_function_prefix + module name.
+ */
+GAL_LANG_MODULE_EXPORT gal::lang::foundation::engine_module_type create_module_test_module()
+{
+	auto m = gal::lang::foundation::make_engine_module();
+
+	m->add_function("test_module_add", gal::lang::fun(&test_module_add));
+	m->add_function("test_module_square", gal::lang::fun(&test_module_square));
+
+	return m;
+}
@@ -0,0 +1,126 @@
+#include <gtest/gtest.h>
+
+#define GAL_LANG_NO_RECODE_CALL_LOCATION_DEBUG
+#define GAL_LANG_NO_AST_VISIT_PRINT
+#include <gal/gal.hpp>
+
+using namespace gal::lang;
+
+namespace
+{
+	[[nodiscard]] const eval_detail::numeric_tier* find_tier(const ast::ast_node& node)
+	{
+		if (node.is<ast::def_ast_node>()) { return dynamic_cast<const ast::def_ast_node&>(node).tier(); }
+
+		for (const auto& child: node.view()) { if (const auto* result = find_tier(child)) { return result; } }
+		return nullptr;
+	}
+}
+
+TEST(TestNumericTier, TestCompiled)
+{
+	engine e{};
+
+	(void)e.eval(R"(
+		def root(x)
+		{
+			var guess = x / 2;
+			var i = 0.0;
+			while (i < 20.0)
+			{
+				guess = (guess + x / guess) * 0.5;
+				i += 1;
+			}
+			return guess;
+		}
+
+		def clamp(x, low, high)
+		{
+			if (x < low) { low * 1.0 } else if (x > high) { high * 1.0 } else { x * 1.0 }
+		}
+	)");
+
+	// the calls after the threshold are made by the compiled function
+	for (std::size_t i = 0; i < 2 * eval_detail::numeric_tier::compile_threshold; ++i)
+	{
+		ASSERT_DOUBLE_EQ(e.boxed_cast<double>(e.eval("root(16.0)")), 4.0);
+		ASSERT_DOUBLE_EQ(e.boxed_cast<double>(e.eval("clamp(-1.0, 0.0, 10.0)")), 0.0);
+		ASSERT_DOUBLE_EQ(e.boxed_cast<double>(e.eval("clamp(5.5, 0.0, 10.0)")), 5.5);
+		ASSERT_DOUBLE_EQ(e.boxed_cast<double>(e.eval("clamp(42.0, 0.0, 10.0)")), 10.0);
+	}
+
+	// the other arguments are left to the interpreter
+	ASSERT_EQ(e.boxed_cast<int>(e.eval("root(16)")), 4);
+	ASSERT_DOUBLE_EQ(e.boxed_cast<double>(e.eval("clamp(5, 0, 10)")), 5.0);
+}
+
+TEST(TestNumericTier, TestUnsupported)
+{
+	engine e{};
+
+	// the call cannot be compiled, the interpreter makes it all the time
+	(void)e.eval(R"(
+		def square(x) { x * x }
+		def sum_of_squares(x, y) { square(x) + square(y) }
+	)");
+
+	const auto node = e.parse(R"(def sum_of_squares_twice(x, y) { sum_of_squares(x, y) * 2.0 })");
+	(void)e.eval(*node);
+
+	for (std::size_t i = 0; i < 2 * eval_detail::numeric_tier::compile_threshold; ++i)
+	{
+		ASSERT_DOUBLE_EQ(e.boxed_cast<double>(e.eval("sum_of_squares(3.0, 4.0)")), 25.0);
+		ASSERT_DOUBLE_EQ(e.boxed_cast<double>(e.eval("sum_of_squares_twice(3.0, 4.0)")), 50.0);
+	}
+	ASSERT_EQ(find_tier(*node)->state(), eval_detail::numeric_tier::state_type::unsupported);
+}
+
+TEST(TestNumericTier, TestIntLocals)
+{
+	engine e{};
+
+	const auto node = e.parse(R"(
+		def weighted_sum(x)
+		{
+			var sum = 0.0;
+			var i = 0;
+			while (i < 10)
+			{
+				sum += x * i;
+				i += 1;
+			}
+			return sum;
+		}
+	)");
+	(void)e.eval(*node);
+
+	const auto* tier = find_tier(*node);
+	ASSERT_NE(tier, nullptr);
+	ASSERT_EQ(tier->state(), eval_detail::numeric_tier::state_type::interpreted);
+
+	for (std::size_t i = 0; i < 2 * eval_detail::numeric_tier::compile_threshold; ++i) { ASSERT_DOUBLE_EQ(e.boxed_cast<double>(e.eval("weighted_sum(0.5)")), 22.5); }
+	ASSERT_EQ(tier->state(), eval_detail::numeric_tier::state_type::compiled);
+
+	// the int local is returned as an int
+	(void)e.eval(R"(
+		def count_below(x)
+		{
+			var n = 0;
+			var v = 0.0;
+			while (v < x) { v += 1.5; n += 1; }
+			n
+		}
+	)");
+	for (std::size_t i = 0; i < 2 * eval_detail::numeric_tier::compile_threshold; ++i) { ASSERT_EQ(e.boxed_cast<int>(e.eval("count_below(6.0)")), 4); }
+}
+
+TEST(TestNumericTier, TestSignedness)
+{
+	engine e{};
+
+	e.add_global_mutable("negative", var(-5));
+	e.add_global_mutable("large", var(std::uint8_t{200}));
+
+	ASSERT_TRUE(e.boxed_cast<bool>(e.eval("negative < 0")));
+	ASSERT_EQ(e.boxed_cast<int>(e.eval("large + 100")), 300);
+}
@@ -0,0 +1,148 @@
+#include <gtest/gtest.h>
+
+#define GAL_LANG_NO_RECODE_CALL_LOCATION_DEBUG
+#define GAL_LANG_NO_AST_VISIT_PRINT
+#include <gal/gal.hpp>
+
+using namespace gal::lang;
+
+namespace
+{
+	// the operator in the body of the function defined by the script
+	const ast::binary_operator_ast_node* find_operator(const ast::ast_node& node)
+	{
+		if (node.is<ast::binary_operator_ast_node>()) { return dynamic_cast<const ast::binary_operator_ast_node*>(&node); }
+		if (node.is<ast::def_ast_node>()) { return find_operator(*dynamic_cast<const ast::def_ast_node&>(node).body_node); }
+
+		for (const auto& child: node.view()) { if (const auto* result = find_operator(child)) { return result; } }
+		return nullptr;
+	}
+}
+
+TEST(TestQuickening, TestArithmetic)
+{
+	engine e{};
+
+	const auto node = e.parse(R"(def add(x, y) { x + y })");
+	(void)e.eval(*node);
+
+	const auto* operation = find_operator(*node);
+	ASSERT_NE(operation, nullptr);
+
+	for (std::size_t i = 0; i < ast::binary_operator_ast_node::quicken_threshold; ++i) { ASSERT_EQ(e.boxed_cast<int>(e.eval("add(1, 2)")), 3); }
+	ASSERT_EQ(operation->specialization(), ast::binary_operator_ast_node::specialization_type::arithmetic);
+	ASSERT_EQ(e.boxed_cast<int>(e.eval("add(40, 2)")), 42);
+
+	// type miss
+	ASSERT_DOUBLE_EQ(e.boxed_cast<double>(e.eval("add(1.5, 2)")), 3.5);
+	ASSERT_EQ(operation->specialization(), ast::binary_operator_ast_node::specialization_type::none);
+}
+
+TEST(TestQuickening, TestFunction)
+{
+	engine e{};
+
+	const auto node = e.parse(R"(def concat(x, y) { x + y })");
+	(void)e.eval(*node);
+
+	const auto* operation = find_operator(*node);
+	ASSERT_NE(operation, nullptr);
+
+	for (std::size_t i = 0; i < ast::binary_operator_ast_node::quicken_threshold; ++i) { ASSERT_TRUE(e.boxed_cast<bool>(e.eval(R"(concat("ab", "c") == "abc")"))); }
+	ASSERT_EQ(operation->specialization(), ast::binary_operator_ast_node::specialization_type::function);
+	ASSERT_TRUE(e.boxed_cast<bool>(e.eval(R"(concat("a", "bc") == "abc")")));
+
+	// the overload set changes
+	e.add_function("+", fun([](const types::string_type& string, const int) { return string; }));
+	ASSERT_TRUE(e.boxed_cast<bool>(e.eval(R"(concat("ab", "c") == "abc")")));
+	ASSERT_EQ(operation->specialization(), ast::binary_operator_ast_node::specialization_type::none);
+}
+
+TEST(TestQuickening, TestPolymorphic)
+{
+	engine e{};
+
+	// the types of the operands change each time, the node stays generic in the end
+	ASSERT_DOUBLE_EQ(e.boxed_cast<double>(e.eval(R"(
+		def add(x, y) { x + y }
+		var sum = 0.0;
+		var i = 0;
+		while (i < 100)
+		{
+			if (i % 2 == 0) { sum += add(i, 1); } else { sum += add(0.5, 0.5); }
+			++i;
+		}
+		sum
+	)")), 2550.0);
+}
+
+TEST(TestQuickening, TestFunctionDefinedLater)
+{
+	engine e{};
+
+	// the call site caches that the function does not exist, until the function is defined
+	(void)e.eval(R"(def call_later(x) { later(x) })");
+	ASSERT_ANY_THROW((void)e.eval("call_later(1)"));
+
+	(void)e.eval(R"(def later(x) { x + 1 })");
+	ASSERT_EQ(e.boxed_cast<int>(e.eval("call_later(1)")), 2);
+	ASSERT_EQ(e.boxed_cast<int>(e.eval("call_later(2)")), 3);
+}
+
+TEST(TestQuickening, TestNativeBodyThrows)
+{
+	engine e{};
+
+	int calls = 0;
+	e.add_function(
+			"explode",
+			fun([&calls](const int) -> int
+			{
+				++calls;
+				throw exception::bad_boxed_cast{"exploded inside the body"};
+			}));
+
+	// the exception thrown by the body is not a mismatch, the body runs once and the exception is passed up
+	try
+	{
+		(void)e.eval("explode(1)");
+		FAIL();
+	}
+	catch (const exception::eval_error& error) { ASSERT_TRUE(error.reason.starts_with("bad_boxed_cast")); }
+	ASSERT_EQ(calls, 1);
+
+	// a mismatched parameter never runs the body
+	ASSERT_THROW((void)e.eval(R"(explode("1"))"), exception::eval_error);
+	ASSERT_EQ(calls, 1);
+}
+
+TEST(TestQuickening, TestSpecializedBodyThrows)
+{
+	engine e{};
+
+	int calls = 0;
+	bool explode = false;
+	e.add_function(
+			"+",
+			fun([&calls, &explode](const types::string_type& string, const int) -> types::string_type
+			{
+				++calls;
+				if (explode) { throw exception::bad_boxed_cast{"exploded inside the body"}; }
+				return string;
+			}));
+
+	const auto node = e.parse(R"(def concat(x, y) { x + y })");
+	(void)e.eval(*node);
+
+	const auto* operation = find_operator(*node);
+	ASSERT_NE(operation, nullptr);
+
+	for (std::size_t i = 0; i < ast::binary_operator_ast_node::quicken_threshold; ++i) { ASSERT_TRUE(e.boxed_cast<bool>(e.eval(R"(concat("ab", 1) == "ab")"))); }
+	ASSERT_EQ(operation->specialization(), ast::binary_operator_ast_node::specialization_type::function);
+
+	// the body is not run a second time by the dispatcher
+	calls = 0;
+	explode = true;
+	ASSERT_ANY_THROW((void)e.eval(R"(concat("ab", 1))"));
+	ASSERT_EQ(calls, 1);
+}
@@ -0,0 +1,39 @@
+#include <gtest/gtest.h>
+
+#define GAL_LANG_NO_RECODE_CALL_LOCATION_DEBUG
+#define GAL_LANG_NO_AST_VISIT_PRINT
+#include <gal/gal.hpp>
+
+using namespace gal::lang;
+
+TEST(TestSavedParams, TestTemporaryArgument)
+{
+	engine e{};
+
+	// the element refers to the temporary list, which is kept alive until the scope ends
+	ASSERT_EQ(e.boxed_cast<int>(e.eval(R"(
+		def make() { [1, 2, 3] }
+		var sum = 0;
+		var i = 0;
+		while (i < 3)
+		{
+			sum += make()[i] + make().back();
+			++i;
+		}
+		sum
+	)")), 15);
+}
+
+TEST(TestSavedParams, TestOwnedArgument)
+{
+	engine e{};
+
+	// the arguments owned by the variables are borrowed, they are not left moved-from
+	ASSERT_EQ(e.boxed_cast<int>(e.eval(R"(
+		var list = [1, 2, 3];
+		var index = 1;
+		var first = list[index] + list.back();
+		var second = list[index] + list.back();
+		first + second + index + list[2]
+	)")), 14);
+}
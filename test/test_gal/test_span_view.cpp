@@ -0,0 +1,67 @@
+#include <gtest/gtest.h>
+
+#define GAL_LANG_NO_RECODE_CALL_LOCATION_DEBUG
+#define GAL_LANG_NO_AST_VISIT_PRINT
+#include <vector>
+#include <gal/gal.hpp>
+
+using namespace gal::lang;
+
+TEST(TestSpanView, TestConstArithmetic)
+{
+	engine e{};
+
+	foundation::engine_module m{};
+	plugin::register_span_view_type<const float>("float_span", m);
+	e.take_module(std::move(m));
+
+	const std::vector samples{1.5f, 2.5f, 3.0f};
+	e.add_global("samples", const_var(types::span_view_type<const float>{samples}));
+
+	// size/empty
+	ASSERT_EQ(e.boxed_cast<std::size_t>(e.eval("samples.size()")), samples.size());
+	ASSERT_FALSE(e.boxed_cast<bool>(e.eval("samples.empty()")));
+
+	// indexing
+	ASSERT_FLOAT_EQ(e.boxed_cast<float>(e.eval("samples[0]")), 1.5f);
+	ASSERT_FLOAT_EQ(e.boxed_cast<float>(e.eval("samples[2]")), 3.0f);
+	ASSERT_ANY_THROW((void)e.eval("samples[3]"));
+	ASSERT_ANY_THROW((void)e.eval("samples[-1]"));
+
+	// ranged-for
+	ASSERT_DOUBLE_EQ(e.boxed_cast<double>(e.eval("var sum = 0.0; for (var x in samples) { sum += x; } sum")), 7.0);
+}
+
+TEST(TestSpanView, TestMutable)
+{
+	engine e{};
+
+	foundation::engine_module m{};
+	plugin::register_span_view_type<int>("int_span", m);
+	e.take_module(std::move(m));
+
+	std::vector values{1, 2, 3};
+	e.add_global_mutable("values", var(types::span_view_type<int>{values}));
+
+	// the elements are accessed by reference, the assignment writes to the host sequence
+	(void)e.eval("values[1] = 20;");
+	ASSERT_EQ(values[1], 20);
+
+	ASSERT_EQ(e.boxed_cast<int>(e.eval("var count = 0; var sum = 0; for (var x in values) { ++count; sum += x; } sum + count * 100")), 324);
+}
+
+TEST(TestSpanView, TestEmpty)
+{
+	engine e{};
+
+	foundation::engine_module m{};
+	plugin::register_span_view_type<const int>("const_int_span", m);
+	e.take_module(std::move(m));
+
+	const std::vector<int> nothing{};
+	e.add_global("nothing", const_var(types::span_view_type<const int>{nothing}));
+
+	ASSERT_EQ(e.boxed_cast<std::size_t>(e.eval("nothing.size()")), std::size_t{0});
+	ASSERT_TRUE(e.boxed_cast<bool>(e.eval("nothing.empty()")));
+	ASSERT_EQ(e.boxed_cast<int>(e.eval("var count = 0; for (var x in nothing) { ++count; } count")), 0);
+}
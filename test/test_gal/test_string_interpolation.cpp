@@ -0,0 +1,74 @@
+#include <gtest/gtest.h>
+
+#define GAL_LANG_NO_RECODE_CALL_LOCATION_DEBUG
+#define GAL_LANG_NO_AST_VISIT_PRINT
+#include <gal/gal.hpp>
+
+using namespace gal::lang;
+
+namespace
+{
+	struct point
+	{
+		int x;
+		int y;
+	};
+
+	[[nodiscard]] types::string_type::container_type interpolate(engine& e, const std::string_view script) { return e.boxed_cast<const types::string_type&>(e.eval(script)).data(); }
+}
+
+TEST(TestStringInterpolation, TestNumber)
+{
+	engine e{};
+
+	ASSERT_EQ(interpolate(e, R"("${1}")"), "1");
+	ASSERT_EQ(interpolate(e, R"("a${1}b${-2}c")"), "a1b-2c");
+	ASSERT_TRUE(e.boxed_cast<bool>(e.eval(R"("${2.5}" == to_string(2.5))")));
+	ASSERT_TRUE(e.boxed_cast<bool>(e.eval(R"(var i = 42; var d = 0.5; "${i} ${d}" == to_string(i) + " " + to_string(d))")));
+}
+
+TEST(TestStringInterpolation, TestString)
+{
+	engine e{};
+
+	ASSERT_EQ(interpolate(e, R"(var s = "world"; "hello ${s}!")"), "hello world!");
+	ASSERT_EQ(interpolate(e, R"(var a = "a"; var b = "b"; "${a}${b}${a}")"), "aba");
+	ASSERT_EQ(interpolate(e, R"("${""}")"), "");
+}
+
+TEST(TestStringInterpolation, TestObject)
+{
+	engine e{};
+
+	foundation::engine_module m{};
+	m.add_type_info("point", foundation::make_type_info<point>());
+	m.add_function("to_string", fun([](const point& p) { return types::string_type{std_format::format("({}, {})", p.x, p.y)}; }));
+	e.take_module(std::move(m));
+
+	e.add_global("p", const_var(point{1, 2}));
+
+	// converted via to_string
+	ASSERT_EQ(interpolate(e, R"("p = ${p}")"), "p = (1, 2)");
+	ASSERT_EQ(interpolate(e, R"("${range(0, 3)}")"), "range(begin=0, end=3, step=1)");
+
+	// no to_string for it
+	ASSERT_THROW((void)e.eval(R"("${[1, 2]}")"), exception::eval_error);
+}
+
+TEST(TestStringInterpolation, TestModifiedByLaterPart)
+{
+	engine e{};
+
+	// all parts are evaluated before the result is written, the first part sees the modified string
+	ASSERT_TRUE(e.boxed_cast<bool>(e.eval(R"(
+		var s = "x";
+		var r = "${s}${s += "abcdefghijklmnopqrstuvwxyz0123456789abcdefghijklmnopqrstuvwxyz"}";
+		r == s + s
+	)")));
+
+	ASSERT_TRUE(e.boxed_cast<bool>(e.eval(R"(
+		var s = "x";
+		var r = "${s}${1}${s += "abcdefghijklmnopqrstuvwxyz0123456789abcdefghijklmnopqrstuvwxyz"}${2}";
+		r == s + "1" + s + "2"
+	)")));
+}
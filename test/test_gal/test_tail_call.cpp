@@ -0,0 +1,55 @@
+#include <gtest/gtest.h>
+
+#define GAL_LANG_NO_RECODE_CALL_LOCATION_DEBUG
+#define GAL_LANG_NO_AST_VISIT_PRINT
+#include <gal/gal.hpp>
+
+using namespace gal::lang;
+
+TEST(TestTailCall, TestDeepRecursion)
+{
+	engine e{};
+
+	// far deeper than the native stack allows if every call recursed
+	const auto result = e.eval(R"(
+		def count_down(n, acc)
+		{
+			if (n == 0) { return acc; }
+			return count_down(n - 1, acc + 1);
+		}
+		count_down(1000000, 0)
+	)");
+
+	ASSERT_EQ(e.boxed_cast<int>(result), 1000000);
+}
+
+TEST(TestTailCall, TestMutualRecursion)
+{
+	engine e{};
+
+	// the last expression (without 'return') is also in tail position
+	const auto result = e.eval(R"(
+		def is_even(n) { if (n == 0) { true } else { is_odd(n - 1) } }
+		def is_odd(n) { if (n == 0) { false } else { is_even(n - 1) } }
+		is_even(1000001)
+	)");
+
+	ASSERT_FALSE(e.boxed_cast<bool>(result));
+}
+
+TEST(TestTailCall, TestNotTailPosition)
+{
+	engine e{};
+
+	// the result of the call is still used by the caller
+	const auto result = e.eval(R"(
+		def sum(n)
+		{
+			if (n == 0) { return 0; }
+			return n + sum(n - 1);
+		}
+		sum(100)
+	)");
+
+	ASSERT_EQ(e.boxed_cast<int>(result), 5050);
+}
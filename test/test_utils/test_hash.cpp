@@ -0,0 +1,96 @@
+#include <gtest/gtest.h>
+
+#include <utils/hash.hpp>
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace gal::utils;
+
+TEST(TestHash, TestWyhashConstexpr)
+{
+	constexpr std::string_view short_string{"abc"};
+	constexpr std::string_view medium_string{"hello gal"};
+	constexpr std::string_view long_string{"a long long long long long long long long long long long long str"};
+
+	constexpr auto short_hash = hash_wyhash(short_string);
+	constexpr auto medium_hash = hash_wyhash(medium_string);
+	constexpr auto long_hash = hash_wyhash(long_string);
+
+	// the result of constant evaluation is the same as runtime
+	ASSERT_EQ(short_hash, hash_wyhash(std::string{short_string}));
+	ASSERT_EQ(medium_hash, hash_wyhash(std::string{medium_string}));
+	ASSERT_EQ(long_hash, hash_wyhash(std::string{long_string}));
+
+	ASSERT_NE(short_hash, medium_hash);
+	ASSERT_NE(medium_hash, long_hash);
+
+	// wide string
+	constexpr std::u16string_view wide_string{u"hello gal"};
+	constexpr auto wide_hash = hash_wyhash(wide_string);
+	ASSERT_EQ(wide_hash, hash_wyhash(std::u16string{wide_string}));
+}
+
+TEST(TestHash, TestWyhashAllLength)
+{
+	std::string string;
+	std::vector<std::uint64_t> hashes;
+
+	for (auto i = 0; i < 256; ++i)
+	{
+		hashes.push_back(hash_wyhash(string));
+		string.push_back(static_cast<char>('a' + i % 26));
+	}
+
+	std::ranges::sort(hashes);
+	ASSERT_EQ(std::ranges::unique(hashes).begin(), hashes.end());
+}
+
+TEST(TestHash, TestStringHasher)
+{
+	constexpr string_hasher hasher{};
+
+	const std::string string{"hello gal"};
+
+	// string literal does not include the '\0'
+	ASSERT_EQ(hasher("hello gal"), hasher(string));
+	ASSERT_EQ(hasher(std::string_view{string}), hasher(string));
+}
+
+// a timing loop, not a test, run it with --gtest_also_run_disabled_tests
+TEST(TestHash, DISABLED_Benchmark)
+{
+	constexpr std::size_t times = 20'000;
+
+	const auto benchmark = [](const std::string_view name, const std::vector<std::string>& keys, auto hasher)
+	{
+		std::uint64_t sink = 0;
+
+		const auto begin = std::chrono::steady_clock::now();
+		for (std::size_t i = 0; i < times; ++i)
+		{
+			for (const auto& key: keys) { sink += hasher(key); }
+		}
+		const auto end = std::chrono::steady_clock::now();
+
+		std::cout << '\t' << name << ": " << std::chrono::duration<double, std::nano>(end - begin).count() / static_cast<double>(times * keys.size()) << "ns/key (" << (sink & 1) << ")\n";
+	};
+
+	for (const auto length: {4, 8, 16, 32, 64, 128, 256})
+	{
+		std::vector<std::string> keys;
+		for (auto i = 0; i < 16; ++i)
+		{
+			auto& key = keys.emplace_back();
+			for (auto j = 0; j < length; ++j) { key.push_back(static_cast<char>('a' + (i * 7 + j) % 26)); }
+		}
+
+		std::cout << "key length " << length << ":\n";
+		benchmark("fnv1a   ", keys, [](const auto& key) { return hash_fnv1a(key); });
+		benchmark("jenkins ", keys, [](const auto& key) { return hash_jenkins_one_at_a_time(key); });
+		benchmark("std hash", keys, [](const auto& key) { return std::hash<std::string>{}(key); });
+		benchmark("wyhash  ", keys, [](const auto& key) { return hash_wyhash(key); });
+	}
+}
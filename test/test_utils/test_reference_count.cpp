@@ -0,0 +1,114 @@
+#include <gtest/gtest.h>
+
+#include <utils/reference_count.hpp>
+
+using namespace gal::utils;
+
+namespace
+{
+	struct counted : intrusive_reference_count
+	{
+		int& destructions;
+		int value;
+
+		counted(int& destructions, const int value)
+			: destructions{destructions},
+			  value{value} {}
+
+		counted(const counted&) = default;
+
+		~counted() noexcept { ++destructions; }
+	};
+}
+
+TEST(TestReferenceCount, TestUseCount)
+{
+	int destructions = 0;
+
+	auto p1 = make_intrusive<counted>(destructions, 42);
+	ASSERT_EQ(p1.use_count(), 1);
+	ASSERT_EQ(p1->value, 42);
+
+	{
+		const auto p2 = p1;
+		ASSERT_EQ(p1.use_count(), 2);
+		ASSERT_EQ(p2.use_count(), 2);
+		ASSERT_TRUE(p1 == p2);
+	}
+
+	ASSERT_EQ(p1.use_count(), 1);
+	ASSERT_EQ(destructions, 0);
+
+	// copying the object does not copy its reference count
+	const auto p3 = make_intrusive<counted>(*p1);
+	ASSERT_EQ(p1.use_count(), 1);
+	ASSERT_EQ(p3.use_count(), 1);
+	ASSERT_EQ(p3->value, 42);
+
+	const intrusive_ptr<counted> empty{};
+	ASSERT_FALSE(empty);
+	ASSERT_EQ(empty.use_count(), 0);
+}
+
+TEST(TestReferenceCount, TestSelfAssignment)
+{
+	int destructions = 0;
+
+	auto p = make_intrusive<counted>(destructions, 42);
+	auto& alias = p;
+
+	p = alias;
+	ASSERT_EQ(p.use_count(), 1);
+	ASSERT_EQ(destructions, 0);
+	ASSERT_EQ(p->value, 42);
+
+	p = std::move(alias);
+	ASSERT_TRUE(p);
+	ASSERT_EQ(p.use_count(), 1);
+	ASSERT_EQ(destructions, 0);
+}
+
+TEST(TestReferenceCount, TestMove)
+{
+	int destructions = 0;
+
+	auto p1 = make_intrusive<counted>(destructions, 1);
+	auto p2 = std::move(p1);
+	// NOLINTNEXTLINE(bugprone-use-after-move)
+	ASSERT_FALSE(p1);
+	ASSERT_EQ(p2.use_count(), 1);
+
+	// the object previously owned by p3 is released
+	auto p3 = make_intrusive<counted>(destructions, 3);
+	p3 = std::move(p2);
+	ASSERT_EQ(destructions, 1);
+	ASSERT_EQ(p3->value, 1);
+	ASSERT_EQ(p3.use_count(), 1);
+
+	// assigning a handle to the same object
+	auto p4 = p3;
+	p3 = p4;
+	ASSERT_EQ(p3.use_count(), 2);
+	ASSERT_EQ(destructions, 1);
+}
+
+TEST(TestReferenceCount, TestReset)
+{
+	int destructions = 0;
+
+	auto p1 = make_intrusive<counted>(destructions, 42);
+	auto p2 = p1;
+
+	p1.reset();
+	ASSERT_FALSE(p1);
+	ASSERT_EQ(p1.use_count(), 0);
+	ASSERT_EQ(p2.use_count(), 1);
+	ASSERT_EQ(destructions, 0);
+
+	p2.reset();
+	ASSERT_EQ(destructions, 1);
+
+	// reset an empty handle
+	p2.reset();
+	ASSERT_EQ(destructions, 1);
+}
@@ -216,3 +216,69 @@ TEST(TestStringPool, TestCustomeCapacity)
 		ASSERT_EQ(std::wcscmp(put_it_in.data(), L"a long long long long long long long long str"), 0);
 	}
 }
+
+TEST(TestStringPool, TestInterning)
+{
+	constexpr static bool is_null_terminated = true;
+	constexpr static bool is_interning = true;
+
+	using char_type = char;
+
+	string_pool<char_type, is_null_terminated, std::char_traits<char_type>, is_interning> pool;
+
+	const auto one = pool.append("one");
+	const auto two = pool.append("two");
+
+	// the same string share the same view
+	{
+		const std::basic_string<char_type> another_one{"one"};
+		const auto one_again = pool.append(another_one);
+
+		ASSERT_EQ(one_again, "one");
+		ASSERT_EQ(one_again.data(), one.data());
+		ASSERT_EQ(pool.find("two").data(), two.data());
+		ASSERT_TRUE(pool.find("three").empty());
+		ASSERT_EQ(pool.interned_size(), 2);
+	}
+
+	// the borrowed string is not interned, but the existing string can be borrowed without copy
+	typename decltype(pool)::view_type four;
+	{
+		auto borrower = pool.borrow_block();
+
+		const auto borrowed_one = borrower.append("one");
+		ASSERT_EQ(borrowed_one.data(), one.data());
+
+		const auto borrowed_three = borrower.append("three");
+		ASSERT_EQ(borrowed_three, "three");
+		ASSERT_TRUE(pool.find("three").empty());
+
+		// appended after the borrowed string, the interned string never moves when the borrowed string returned
+		four = pool.append("four");
+		ASSERT_EQ(four, "four");
+	}
+
+	ASSERT_EQ(pool.find("four").data(), four.data());
+	ASSERT_STREQ(four.data(), "four");
+	ASSERT_STREQ(one.data(), "one");
+	ASSERT_EQ(pool.append("four").data(), four.data());
+	ASSERT_EQ(pool.interned_size(), 3);
+}
+
+TEST(TestStringPool, TestBorrowerFind)
+{
+	using char_type = char;
+
+	string_pool<char_type> pool;
+
+	auto borrower = pool.borrow_block();
+	ASSERT_EQ(borrower.size(), 0);
+
+	const auto one = borrower.append("one");
+	ASSERT_EQ(borrower.size(), 1);
+
+	// the borrowed string can be reused without borrowing it again
+	ASSERT_EQ(borrower.find("one").data(), one.data());
+	ASSERT_TRUE(borrower.find("two").empty());
+	ASSERT_EQ(borrower.size(), 1);
+}